@@ -0,0 +1,38 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ENCOUNTER_SIM_ALLOCATION_COUNTER_H
+#define ENCOUNTER_SIM_ALLOCATION_COUNTER_H
+
+#include "Define.h"
+
+// Heap allocations made by the process so far, counted by the replaced global operator new
+uint64 GetAllocationCount();
+
+// Counts the allocations made while it lives
+class AllocationScope
+{
+public:
+    AllocationScope() : _start(GetAllocationCount()) { }
+
+    uint64 GetCount() const { return GetAllocationCount() - _start; }
+
+private:
+    uint64 _start;
+};
+
+#endif
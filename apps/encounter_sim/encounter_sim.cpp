@@ -0,0 +1,647 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "encounter_sim.h"
+#include "EventMap.h"
+#include "Random.h"
+#include "naxxramas.h"
+#include "naxxramas_40_polarity.h"
+#include "naxxramas_40_positions.h"
+#include "naxxramas_40_targeting.h"
+#include <cmath>
+#include <iterator>
+#include <numbers>
+
+static constexpr uint32 SimPulseInterval     = 1000; // players move and build threat once per pulse
+static constexpr uint32 SimDeathChance       = 2;    // per mille, per player and pulse
+static constexpr float SimMeleeDistance      = 3.0f;
+static constexpr float SimRangedDistance     = 30.0f;
+
+SimRaid::SimRaid() : _boss(ObjectGuid(uint64(1) << 48), false)
+{
+    static constexpr uint8 RaidClasses[] { CLASS_WARRIOR, CLASS_ROGUE, CLASS_MAGE, CLASS_WARLOCK, CLASS_HUNTER, CLASS_PRIEST, CLASS_DRUID, CLASS_PALADIN, CLASS_SHAMAN };
+
+    for (uint8 i = 0; i < SimRaidSize; ++i)
+    {
+        SimRole role = i < 2 ? SIM_ROLE_TANK : i < 10 ? SIM_ROLE_MELEE : i < 32 ? SIM_ROLE_RANGED : SIM_ROLE_HEALER;
+        uint8 classId;
+        switch (role)
+        {
+            case SIM_ROLE_TANK:
+                classId = CLASS_WARRIOR;
+                break;
+            case SIM_ROLE_MELEE:
+                classId = RaidClasses[i % 2];
+                break;
+            case SIM_ROLE_RANGED:
+                classId = RaidClasses[2 + i % 3];
+                break;
+            default:
+                classId = RaidClasses[5 + i % 4];
+                break;
+        }
+
+        auto player = std::make_unique<Player>(ObjectGuid(i + 1), classId);
+        player->setPowerType(classId == CLASS_WARRIOR ? POWER_RAGE : classId == CLASS_ROGUE ? POWER_ENERGY : POWER_MANA);
+        _map.AddPlayer(player.get());
+        _players.push_back(std::move(player));
+        _roles.push_back(role);
+    }
+}
+
+void SimRaid::Reset(Position const& center)
+{
+    _noise = urand(1, UINT32_MAX);
+    _center = center;
+    _pulseTimer = 0;
+    _boss.Relocate(center.GetPositionX(), center.GetPositionY(), center.GetPositionZ());
+    _boss.SetMaxHealth(5000000);
+    _boss.GetThreatMgr().ClearReferences();
+
+    for (uint8 i = 0; i < SimRaidSize; ++i)
+    {
+        Player* player = _players[i].get();
+        float distance = _roles[i] <= SIM_ROLE_MELEE ? SimMeleeDistance : SimRangedDistance;
+        float angle = 2.0f * std::numbers::pi_v<float> * i / SimRaidSize;
+        player->Relocate(center.GetPositionX() + distance * std::cos(angle), center.GetPositionY() + distance * std::sin(angle), center.GetPositionZ());
+        player->SetMaxHealth(_roles[i] == SIM_ROLE_TANK ? 9500 : urand(4000, 6500));
+        player->SetPower(urand(1000, 9000));
+        player->RemoveAllAuras();
+        player->SetAlive(true);
+
+        _roster.Add(player);
+        _roster.SetAlive(player, true);
+        _boss.AddThreat(player, _roles[i] == SIM_ROLE_TANK ? 2000.0f : 10.0f);
+    }
+
+    _boss.GetThreatMgr().Update();
+}
+
+void SimRaid::Kill(Player* player)
+{
+    player->SetAlive(false);
+    player->RemoveAllAuras();
+    _roster.SetAlive(player, false);
+    _boss.GetThreatMgr().RemoveTarget(player);
+}
+
+uint32 SimRaid::NextNoise()
+{
+    _noise ^= _noise << 13;
+    _noise ^= _noise >> 17;
+    _noise ^= _noise << 5;
+    return _noise;
+}
+
+float SimRaid::NextSignedNoise()
+{
+    return float(int32(NextNoise())) / 2147483648.0f;
+}
+
+void SimRaid::Update(uint32 diff)
+{
+    _pulseTimer += diff;
+    if (_pulseTimer < SimPulseInterval)
+        return;
+
+    _pulseTimer -= SimPulseInterval;
+    for (auto const& player : _players)
+        player->UpdateAuras(SimPulseInterval);
+
+    for (uint8 i = 0; i < SimRaidSize; ++i)
+    {
+        Player* player = _players[i].get();
+        if (!player->IsAlive())
+            continue;
+
+        if (_roles[i] != SIM_ROLE_TANK && NextNoise() % 1000 < SimDeathChance)
+        {
+            Kill(player);
+            continue;
+        }
+
+        static constexpr float ThreatPerSecond[] { 900.0f, 450.0f, 500.0f, 150.0f };
+        _boss.AddThreat(player, ThreatPerSecond[_roles[i]] * (1.0f + 0.2f * NextSignedNoise()));
+
+        if (_roles[i] == SIM_ROLE_TANK)
+            continue;
+
+        // Melee keep to the boss, the others drift around their spot
+        float step = _roles[i] == SIM_ROLE_MELEE ? 0.6f : 1.5f;
+        float x = player->GetPositionX() + step * NextSignedNoise();
+        float y = player->GetPositionY() + step * NextSignedNoise();
+        float dx = x - _center.GetPositionX();
+        float dy = y - _center.GetPositionY();
+        float maxDistance = _roles[i] == SIM_ROLE_MELEE ? SimMeleeDistance + 1.0f : SimRangedDistance + 10.0f;
+        if (dx * dx + dy * dy <= maxDistance * maxDistance)
+            player->Relocate(x, y, player->GetPositionZ());
+    }
+
+    _boss.GetThreatMgr().Update();
+    _boss.SetHealth(_boss.GetHealth() > 15000 ? _boss.GetHealth() - 15000 : 1);
+}
+
+namespace
+{
+    float GetHealthPct(Unit const& unit)
+    {
+        return 100.0f * unit.GetHealth() / unit.GetMaxHealth();
+    }
+
+    // boss_patchwerk_40: Hateful Strike on the healthiest of the three most hated in melee range
+    class SimPatchwerk : public SimEncounter
+    {
+    public:
+        enum
+        {
+            EVENT_HATEFUL_STRIKE = 2,
+            EVENT_SLIME_BOLT     = 3,
+            EVENT_BERSERK        = 4
+        };
+
+        char const* GetName() const override { return "Patchwerk"; }
+        Position GetCenter() const override { return { 3164.0f, -3297.0f, 297.0f }; }
+
+        void Reset(SimRaid& /*raid*/) override
+        {
+            events.Reset();
+            events.ScheduleEvent(EVENT_HATEFUL_STRIKE, 1200ms);
+            events.ScheduleEvent(EVENT_BERSERK, 6min);
+        }
+
+        uint32 Update(SimRaid& raid, uint32 diff) override
+        {
+            Unit* me = &raid.GetBoss();
+            events.Update(diff);
+            uint32 eventId = events.ExecuteEvent();
+            switch (eventId)
+            {
+                case EVENT_HATEFUL_STRIKE:
+                {
+                    FixedVector<Unit*, 3> meleeRangeTargets = SelectTopThreat<3>(me->GetThreatMgr(), [me](Unit* target)
+                    {
+                        return me->IsWithinMeleeRange(target);
+                    });
+
+                    for (Unit* target : SelectTopThreat<3>(me->GetThreatMgr()))
+                        me->AddThreat(target, 500.0f);
+
+                    Unit* finalTarget = nullptr;
+                    if (meleeRangeTargets.size() == 1)
+                        finalTarget = meleeRangeTargets[0];
+                    else
+                    {
+                        for (std::size_t i = 1; i < meleeRangeTargets.size(); ++i)
+                            if (!finalTarget || meleeRangeTargets[i]->GetHealth() > finalTarget->GetHealth())
+                                finalTarget = meleeRangeTargets[i];
+                    }
+
+                    if (finalTarget)
+                        finalTarget->SetHealth(finalTarget->GetHealth() / 2);
+
+                    events.Repeat(1200ms);
+                    break;
+                }
+                case EVENT_BERSERK:
+                    events.ScheduleEvent(EVENT_SLIME_BOLT, 3s);
+                    break;
+                case EVENT_SLIME_BOLT:
+                    events.Repeat(3s);
+                    break;
+            }
+
+            return eventId;
+        }
+
+    private:
+        EventMap events;
+    };
+
+    // boss_grobbulus_40: Mutating Injection on a random player in range without it, never the tank
+    class SimGrobbulus : public SimEncounter
+    {
+    public:
+        enum
+        {
+            EVENT_BERSERK            = 1,
+            EVENT_POISON_CLOUD       = 2,
+            EVENT_SLIME_SPRAY        = 3,
+            EVENT_MUTATING_INJECTION = 4
+        };
+
+        static constexpr uint32 SPELL_MUTATING_INJECTION = 28169;
+
+        char const* GetName() const override { return "Grobbulus"; }
+        Position GetCenter() const override { return { 3260.0f, -3305.0f, 293.0f }; }
+
+        void Reset(SimRaid& /*raid*/) override
+        {
+            events.Reset();
+            events.ScheduleEvent(EVENT_POISON_CLOUD, 15s);
+            events.ScheduleEvent(EVENT_SLIME_SPRAY, 20s);
+            events.ScheduleEvent(EVENT_MUTATING_INJECTION, 20s);
+            events.ScheduleEvent(EVENT_BERSERK, 12min);
+        }
+
+        uint32 Update(SimRaid& raid, uint32 diff) override
+        {
+            Unit* me = &raid.GetBoss();
+            events.Update(diff);
+            uint32 eventId = events.ExecuteEvent();
+            switch (eventId)
+            {
+                case EVENT_POISON_CLOUD:
+                    events.Repeat(15s);
+                    break;
+                case EVENT_SLIME_SPRAY:
+                    events.Repeat(20s);
+                    break;
+                case EVENT_MUTATING_INJECTION:
+                    if (Unit* target = SelectRandomThreatTarget(me->GetThreatMgr(),
+                        NaxxTarget::AllOf(NaxxTarget::IsPlayer(), NaxxTarget::InRange{ me, 100.0f }, NaxxTarget::NotAura{ SPELL_MUTATING_INJECTION }), 1))
+                    {
+                        target->AddAura(SPELL_MUTATING_INJECTION, 10000);
+                    }
+                    events.Repeat(Milliseconds(6000 + uint32(120 * GetHealthPct(*me))));
+                    break;
+            }
+
+            return eventId;
+        }
+
+    private:
+        EventMap events;
+    };
+
+    // boss_maexxna_40: Web Wrap on random players, never the tank nor those already wrapped
+    class SimMaexxna : public SimEncounter
+    {
+    public:
+        enum
+        {
+            EVENT_WEB_SPRAY       = 1,
+            EVENT_POISON_SHOCK    = 2,
+            EVENT_NECROTIC_POISON = 3,
+            EVENT_WEB_WRAP        = 4
+        };
+
+        static constexpr uint32 SPELL_WEB_WRAP_STUN = 28622;
+
+        char const* GetName() const override { return "Maexxna"; }
+        Position GetCenter() const override { return { 3486.6f, -3890.6f, 297.0f }; }
+
+        void Reset(SimRaid& /*raid*/) override
+        {
+            events.Reset();
+            events.ScheduleEvent(EVENT_WEB_WRAP, 20s);
+            events.ScheduleEvent(EVENT_WEB_SPRAY, 40s);
+            events.ScheduleEvent(EVENT_POISON_SHOCK, 10s);
+            events.ScheduleEvent(EVENT_NECROTIC_POISON, 5s);
+        }
+
+        uint32 Update(SimRaid& raid, uint32 diff) override
+        {
+            Unit* me = &raid.GetBoss();
+            events.Update(diff);
+            uint32 eventId = events.ExecuteEvent();
+            switch (eventId)
+            {
+                case EVENT_WEB_WRAP:
+                    for (Unit* target : SelectRandomThreat<2>(me->GetThreatMgr(), 2,
+                        NaxxTarget::AllOf(NaxxTarget::IsPlayer(), NaxxTarget::NotTank{ me }, NaxxTarget::NotAura{ SPELL_WEB_WRAP_STUN })))
+                    {
+                        target->AddAura(SPELL_WEB_WRAP_STUN, 20000);
+                    }
+                    events.Repeat(40s);
+                    break;
+                case EVENT_WEB_SPRAY:
+                    events.Repeat(40s);
+                    break;
+                case EVENT_POISON_SHOCK:
+                    events.Repeat(10s);
+                    break;
+                case EVENT_NECROTIC_POISON:
+                    events.Repeat(5s);
+                    break;
+            }
+
+            return eventId;
+        }
+
+    private:
+        EventMap events;
+    };
+
+    // boss_thaddius_40: players swap charges on Polarity Shift, every charge pulse counts
+    // the players of the same sign around it on the polarity grid
+    class SimThaddius : public SimEncounter
+    {
+    public:
+        enum
+        {
+            EVENT_THADDIUS_CHAIN_LIGHTNING = 7,
+            EVENT_THADDIUS_POLARITY_SHIFT  = 9,
+            EVENT_CHARGE_PULSE             = 32 // the periodic trigger of the polarity auras
+        };
+
+        static constexpr uint32 SPELL_POSITIVE_POLARITY = 28059;
+        static constexpr uint32 SPELL_NEGATIVE_POLARITY = 28084;
+        static constexpr float ChargeRadius = 13.0f;
+
+        char const* GetName() const override { return "Thaddius"; }
+        Position GetCenter() const override { return { 3508.0f, -2930.0f, 302.0f }; }
+
+        void Reset(SimRaid& /*raid*/) override
+        {
+            events.Reset();
+            time = 0;
+            grid.Clear();
+            grid.Activate(SPELL_POSITIVE_POLARITY, SPELL_NEGATIVE_POLARITY);
+            events.ScheduleEvent(EVENT_THADDIUS_CHAIN_LIGHTNING, 14s);
+            events.ScheduleEvent(EVENT_THADDIUS_POLARITY_SHIFT, 30s);
+        }
+
+        uint32 Update(SimRaid& raid, uint32 diff) override
+        {
+            time += diff;
+            events.Update(diff);
+            uint32 eventId = events.ExecuteEvent();
+            switch (eventId)
+            {
+                case EVENT_THADDIUS_CHAIN_LIGHTNING:
+                    events.Repeat(15s);
+                    break;
+                case EVENT_THADDIUS_POLARITY_SHIFT:
+                    for (RaidRosterEntry const& entry : raid.GetRoster().GetEntries())
+                    {
+                        if (!RaidRoster::IsActive(entry))
+                            continue;
+
+                        entry.player->RemoveAurasDueToSpell(SPELL_POSITIVE_POLARITY);
+                        entry.player->RemoveAurasDueToSpell(SPELL_NEGATIVE_POLARITY);
+                        entry.player->AddAura(roll_chance_i(50) ? SPELL_POSITIVE_POLARITY : SPELL_NEGATIVE_POLARITY, 60000);
+                    }
+                    events.ScheduleEvent(EVENT_CHARGE_PULSE, 5s);
+                    events.Repeat(30s);
+                    break;
+                case EVENT_CHARGE_PULSE:
+                {
+                    // Every charged player's spell refreshes the grid as spell_thaddius_pos_neg_charge
+                    // does, only the first one of the update builds it
+                    uint32 sameSign = 0;
+                    for (RaidRosterEntry const& entry : raid.GetRoster().GetEntries())
+                    {
+                        if (!RaidRoster::IsActive(entry))
+                            continue;
+
+                        bool positive = entry.player->HasAura(SPELL_POSITIVE_POLARITY);
+                        if (!positive && !entry.player->HasAura(SPELL_NEGATIVE_POLARITY))
+                            continue;
+
+                        grid.Refresh(raid.GetRoster(), time);
+                        sameSign += grid.CountNear(entry.player, positive, ChargeRadius);
+                    }
+                    stacks += sameSign;
+                    events.Repeat(5s);
+                    break;
+                }
+            }
+
+            return eventId;
+        }
+
+    private:
+        EventMap events;
+        PolarityGrid grid;
+        uint64 stacks{};
+        uint64 time{};
+    };
+
+    // boss_gothik_40: the sides of the room are refreshed on every update, each summon
+    // picks a random active player on its own side
+    class SimGothik : public SimEncounter
+    {
+    public:
+        enum
+        {
+            EVENT_SUMMON_ADDS   = 1,
+            EVENT_CHECK_PLAYERS = 6
+        };
+
+        static constexpr NaxxRoomBounds LiveSideBounds { 2633.84f, 2750.49f, -3434.0f, GothikGateY };
+        static constexpr NaxxRoomBounds DeadSideBounds { 2633.84f, 2750.49f, GothikGateY, -3285.0f };
+        static constexpr uint32 WaveTimers[] { 20000, 20000, 10000, 10000, 15000, 10000, 15000, 10000, 10000, 10000, 5000, 15000 };
+
+        char const* GetName() const override { return "Gothik"; }
+        Position GetCenter() const override { return { 2692.5f, -3360.0f, 267.7f }; }
+
+        void Reset(SimRaid& raid) override
+        {
+            events.Reset();
+            waveCount = 0;
+            events.ScheduleEvent(EVENT_SUMMON_ADDS, 30s);
+            events.ScheduleEvent(EVENT_CHECK_PLAYERS, 2min);
+
+            // Half of the raid on each side of the gate
+            for (auto const& player : raid.GetPlayers())
+                player->Relocate(player->GetPositionX(), player->GetPositionY() + (player->GetGUID().GetRawValue() % 2 ? -25.0f : 25.0f), player->GetPositionZ());
+        }
+
+        uint32 Update(SimRaid& raid, uint32 diff) override
+        {
+            Unit* me = &raid.GetBoss();
+            sides.Refresh(raid.GetRoster());
+            uint64 alive = sides.AliveMask();
+            uint64 inReach = sides.WithinDistMask(*me, 200.0f) & alive & ~sides.GameMasterMask();
+            uint64 liveSide = sides.BelowYMask(GothikGateY);
+            liveSidePlayers = inReach & liveSide;
+            deadSidePlayers = inReach & ~liveSide;
+            groupSplitted = (sides.InsideMask(LiveSideBounds) & alive) && (sides.InsideMask(DeadSideBounds) & alive);
+
+            events.Update(diff);
+            uint32 eventId = events.ExecuteEvent();
+            switch (eventId)
+            {
+                case EVENT_SUMMON_ADDS:
+                    // Three adds per wave on the living side, their corpses rise on the other side
+                    for (uint8 i = 0; i < 3; ++i)
+                        Summon(raid, liveSidePlayers);
+                    Summon(raid, deadSidePlayers);
+                    events.Repeat(Milliseconds(WaveTimers[waveCount++ % std::size(WaveTimers)]));
+                    break;
+                case EVENT_CHECK_PLAYERS:
+                    events.Repeat(5s);
+                    break;
+            }
+
+            return eventId;
+        }
+
+    private:
+        void Summon(SimRaid& raid, uint64 mask)
+        {
+            std::vector<RaidRosterEntry> const& roster = raid.GetRoster().GetEntries();
+            uint8 index = PlayerPositionSnapshot::SelectRandomIndex(mask);
+            if (index < roster.size() && RaidRoster::IsActive(roster[index]) && raid.GetBoss().IsWithinDist(roster[index].player, 200.0f))
+                ++attacks;
+        }
+
+        EventMap events;
+        PlayerPositionSnapshot sides;
+        uint64 liveSidePlayers{};
+        uint64 deadSidePlayers{};
+        uint64 attacks{};
+        uint32 waveCount{};
+        bool groupSplitted{};
+    };
+
+    // boss_sapphiron_40: Icebolts of a flight phase never hit the same player twice
+    class SimSapphiron : public SimEncounter
+    {
+    public:
+        enum
+        {
+            EVENT_FLIGHT_START   = 6,
+            EVENT_FLIGHT_ICEBOLT = 8,
+            EVENT_LAND           = 12
+        };
+
+        char const* GetName() const override { return "Sapphiron"; }
+        Position GetCenter() const override { return { 3523.5f, -5235.3f, 137.6f }; }
+
+        void Reset(SimRaid& raid) override
+        {
+            events.Reset();
+            iceboltTargets = std::make_unique<RaidMemberSet>(raid.GetRoster());
+            events.ScheduleEvent(EVENT_FLIGHT_START, 45s);
+        }
+
+        uint32 Update(SimRaid& raid, uint32 diff) override
+        {
+            Unit* me = &raid.GetBoss();
+            events.Update(diff);
+            uint32 eventId = events.ExecuteEvent();
+            switch (eventId)
+            {
+                case EVENT_FLIGHT_START:
+                    iceboltTargets->Clear();
+                    iceboltCount = 3;
+                    events.ScheduleEvent(EVENT_FLIGHT_ICEBOLT, 3s);
+                    break;
+                case EVENT_FLIGHT_ICEBOLT:
+                {
+                    Unit* target = iceboltCount ? SelectRandomThreatTarget(me->GetThreatMgr(), NaxxTarget::AllOf(NaxxTarget::IsPlayer(), NaxxTarget::NotInSet{ *iceboltTargets })) : nullptr;
+                    if (target)
+                    {
+                        iceboltTargets->Insert(target);
+                        --iceboltCount;
+                        events.ScheduleEvent(EVENT_FLIGHT_ICEBOLT, 3s);
+                    }
+                    else
+                        events.ScheduleEvent(EVENT_LAND, 10s);
+                    break;
+                }
+                case EVENT_LAND:
+                    events.ScheduleEvent(EVENT_FLIGHT_START, 67s);
+                    break;
+            }
+
+            return eventId;
+        }
+
+    private:
+        EventMap events;
+        std::unique_ptr<RaidMemberSet> iceboltTargets;
+        uint8 iceboltCount{};
+    };
+
+    // boss_kelthuzad_40, phase 2: Frost Blast, Chains and Detonate Mana
+    class SimKelThuzad : public SimEncounter
+    {
+    public:
+        enum
+        {
+            EVENT_FROSTBOLT_SINGLE = 5,
+            EVENT_DETONATE_MANA    = 7,
+            EVENT_FROST_BLAST      = 11,
+            EVENT_CHAINS           = 12
+        };
+
+        static constexpr uint32 SPELL_CHAINS_OF_KELTHUZAD = 28410;
+
+        char const* GetName() const override { return "Kel'Thuzad"; }
+        Position GetCenter() const override { return { 3716.0f, -5107.0f, 141.3f }; }
+
+        void Reset(SimRaid& /*raid*/) override
+        {
+            events.Reset();
+            events.ScheduleEvent(EVENT_FROSTBOLT_SINGLE, 2s, 10s);
+            events.ScheduleEvent(EVENT_DETONATE_MANA, 30s);
+            events.ScheduleEvent(EVENT_FROST_BLAST, 25s);
+            events.ScheduleEvent(EVENT_CHAINS, 90s);
+        }
+
+        uint32 Update(SimRaid& raid, uint32 diff) override
+        {
+            Unit* me = &raid.GetBoss();
+            events.Update(diff);
+            uint32 eventId = events.ExecuteEvent();
+            switch (eventId)
+            {
+                case EVENT_FROSTBOLT_SINGLE:
+                    events.Repeat(2s, 10s);
+                    break;
+                case EVENT_FROST_BLAST:
+                    if (Unit* target = SelectRandomThreatTarget(me->GetThreatMgr(), NaxxTarget::IsPlayer()))
+                        target->SetHealth(target->GetHealth() / 2);
+                    events.Repeat(45s);
+                    break;
+                case EVENT_CHAINS:
+                    for (Unit* target : SelectRandomThreat<3>(me->GetThreatMgr(), 3,
+                        NaxxTarget::AllOf(NaxxTarget::IsPlayer(), NaxxTarget::InRange{ me, 200.0f }, NaxxTarget::NotAura{ SPELL_CHAINS_OF_KELTHUZAD }), 1))
+                    {
+                        target->AddAura(SPELL_CHAINS_OF_KELTHUZAD, 20000);
+                    }
+                    events.Repeat(90s);
+                    break;
+                case EVENT_DETONATE_MANA:
+                    if (Unit* target = SelectRandomThreatTarget(me->GetThreatMgr(), NaxxTarget::AllOf(NaxxTarget::IsPlayer(), NaxxTarget::HasPower{ POWER_MANA })))
+                        target->SetPower(0);
+                    events.Repeat(30s);
+                    break;
+            }
+
+            return eventId;
+        }
+
+    private:
+        EventMap events;
+    };
+}
+
+std::vector<std::unique_ptr<SimEncounter>> CreateSimEncounters()
+{
+    std::vector<std::unique_ptr<SimEncounter>> encounters;
+    encounters.push_back(std::make_unique<SimPatchwerk>());
+    encounters.push_back(std::make_unique<SimGrobbulus>());
+    encounters.push_back(std::make_unique<SimMaexxna>());
+    encounters.push_back(std::make_unique<SimThaddius>());
+    encounters.push_back(std::make_unique<SimGothik>());
+    encounters.push_back(std::make_unique<SimSapphiron>());
+    encounters.push_back(std::make_unique<SimKelThuzad>());
+    return encounters;
+}
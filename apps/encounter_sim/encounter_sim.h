@@ -0,0 +1,90 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ENCOUNTER_SIM_H
+#define ENCOUNTER_SIM_H
+
+#include "Map.h"
+#include "Player.h"
+#include "naxxramas_40_roster.h"
+#include <memory>
+#include <vector>
+
+static constexpr uint8 SimRaidSize = 40;
+
+enum SimRole : uint8
+{
+    SIM_ROLE_TANK,
+    SIM_ROLE_MELEE,
+    SIM_ROLE_RANGED,
+    SIM_ROLE_HEALER
+};
+
+// A synthetic 40 player raid: players move around the boss, build threat and die now and then.
+// The roster is kept up to date the way instance_naxxramas does it from the map hooks.
+class SimRaid
+{
+public:
+    SimRaid();
+
+    // Places the raid around center with a fresh threat list, everyone alive
+    void Reset(Position const& center);
+    // Movement, threat and deaths of the raid, not part of the measured script time
+    void Update(uint32 diff);
+
+    Unit& GetBoss() { return _boss; }
+    Map const& GetMap() const { return _map; }
+    RaidRoster& GetRoster() { return _roster; }
+    std::vector<std::unique_ptr<Player>> const& GetPlayers() const { return _players; }
+    SimRole GetRole(uint8 index) const { return _roles[index]; }
+
+    void Kill(Player* player);
+
+private:
+    // The raid moves on its own xorshift generator, the scripts' random rolls stay with urand
+    uint32 NextNoise();
+    float NextSignedNoise(); // in [-1, 1)
+
+    Position _center;
+    Unit _boss;
+    Map _map;
+    RaidRoster _roster;
+    std::vector<std::unique_ptr<Player>> _players;
+    std::vector<SimRole> _roles;
+    uint32 _pulseTimer{};
+    uint32 _noise{ 1 };
+};
+
+// One boss script reduced to the event timers and target selections of its AI, running the
+// module's selection kernels on the synthetic raid. Mirrors the Events enum of the boss script.
+class SimEncounter
+{
+public:
+    virtual ~SimEncounter() = default;
+
+    virtual char const* GetName() const = 0;
+    virtual Position GetCenter() const = 0;
+    virtual uint32 GetDuration() const { return 5 * 60 * 1000; }
+
+    virtual void Reset(SimRaid& raid) = 0;
+    // Returns the executed event id, 0 when the tick executed none
+    virtual uint32 Update(SimRaid& raid, uint32 diff) = 0;
+};
+
+std::vector<std::unique_ptr<SimEncounter>> CreateSimEncounters();
+
+#endif
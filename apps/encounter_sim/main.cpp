@@ -0,0 +1,144 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headless encounter simulator: runs the boss encounters against a synthetic 40 player raid and
+// reports the script time per tick and the heap allocations per fight.
+//
+// encounter_sim [--fights N] [--tick MS] [--seed SEED] [--encounter NAME]
+
+#include "Random.h"
+#include "allocation_counter.h"
+#include "encounter_sim.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+
+struct SimOptions
+{
+    uint32 fights{ 200 };
+    uint32 tick{ 100 };
+    uint32 seed{ 1 };
+    char const* encounter{};
+};
+
+static bool ParseOptions(int argc, char** argv, SimOptions& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string_view arg = argv[i];
+        if (i + 1 >= argc)
+            return false;
+
+        if (arg == "--fights")
+            options.fights = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--tick")
+            options.tick = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--seed")
+            options.seed = uint32(std::strtoul(argv[++i], nullptr, 10));
+        else if (arg == "--encounter")
+            options.encounter = argv[++i];
+        else
+            return false;
+    }
+
+    return true;
+}
+
+static uint64 GetPercentile(std::vector<uint32>& samples, float pct)
+{
+    if (samples.empty())
+        return 0;
+
+    auto nth = samples.begin() + std::size_t(pct * (samples.size() - 1));
+    std::nth_element(samples.begin(), nth, samples.end());
+    return *nth;
+}
+
+int main(int argc, char** argv)
+{
+    SimOptions options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        std::fprintf(stderr, "usage: %s [--fights N] [--tick MS] [--seed SEED] [--encounter NAME]\n", argv[0]);
+        return 1;
+    }
+
+    SetSimulatorRandomSeed(options.seed);
+
+    std::printf("%u fights per encounter, %u ms ticks, seed %u\n\n", options.fights, options.tick, options.seed);
+    std::printf("%-12s %8s %10s %10s %10s %10s %12s %12s %10s\n", "Encounter", "ticks", "events", "ns/tick", "p50 ns", "p99 ns", "max ns", "allocs/fight", "fights/s");
+
+    SimRaid raid;
+    bool found = false;
+    for (auto const& encounter : CreateSimEncounters())
+    {
+        if (options.encounter && std::strcmp(options.encounter, encounter->GetName()))
+            continue;
+
+        found = true;
+        uint32 ticksPerFight = encounter->GetDuration() / options.tick;
+        std::vector<uint32> samples;
+        samples.reserve(std::size_t(ticksPerFight) * options.fights);
+
+        uint64 scriptNanos = 0;
+        uint64 allocations = 0;
+        uint64 events = 0;
+        auto wallStart = std::chrono::steady_clock::now();
+
+        for (uint32 fight = 0; fight < options.fights; ++fight)
+        {
+            raid.Reset(encounter->GetCenter());
+            encounter->Reset(raid);
+
+            for (uint32 tick = 0; tick < ticksPerFight; ++tick)
+            {
+                raid.Update(options.tick);
+
+                AllocationScope allocationScope;
+                auto start = std::chrono::steady_clock::now();
+                if (encounter->Update(raid, options.tick))
+                    ++events;
+                auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+                allocations += allocationScope.GetCount();
+
+                scriptNanos += nanos;
+                samples.push_back(uint32(std::min<int64>(nanos, UINT32_MAX)));
+            }
+        }
+
+        double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+        uint64 ticks = samples.size();
+        uint64 maxNanos = *std::max_element(samples.begin(), samples.end());
+        uint64 p99 = GetPercentile(samples, 0.99f);
+        uint64 p50 = GetPercentile(samples, 0.5f);
+
+        std::printf("%-12s %8u %10llu %10.1f %10llu %10llu %12llu %12.2f %10.0f\n", encounter->GetName(), ticksPerFight,
+            (unsigned long long)events, double(scriptNanos) / ticks, (unsigned long long)p50, (unsigned long long)p99,
+            (unsigned long long)maxNanos, double(allocations) / options.fights, options.fights / wallSeconds);
+    }
+
+    if (!found)
+    {
+        std::fprintf(stderr, "unknown encounter %s\n", options.encounter);
+        return 1;
+    }
+
+    return 0;
+}
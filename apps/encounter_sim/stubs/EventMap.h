@@ -0,0 +1,104 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Stand-in for the AzerothCore EventMap with the same scheduling semantics: events are due
+// once their time has passed, ExecuteEvent returns the earliest due one and Repeat reschedules
+// the event that was just executed. Fixed storage, so it adds no allocations to the encounters.
+#ifndef ENCOUNTER_SIM_EVENTMAP_H
+#define ENCOUNTER_SIM_EVENTMAP_H
+
+#include "Define.h"
+#include "Random.h"
+#include <array>
+#include <chrono>
+
+typedef std::chrono::milliseconds Milliseconds;
+typedef std::chrono::seconds Seconds;
+typedef std::chrono::minutes Minutes;
+
+using namespace std::chrono_literals;
+
+class EventMap
+{
+public:
+    void Reset()
+    {
+        _count = 0;
+        _time = 0;
+        _lastEvent = 0;
+    }
+
+    void Update(uint32 diff) { _time += diff; }
+
+    void ScheduleEvent(uint32 eventId, Milliseconds time)
+    {
+        if (_count < EventMapCapacity)
+            _events[_count++] = { _time + uint32(time.count()), eventId };
+    }
+
+    void ScheduleEvent(uint32 eventId, Milliseconds minTime, Milliseconds maxTime)
+    {
+        ScheduleEvent(eventId, Milliseconds(urand(uint32(minTime.count()), uint32(maxTime.count()))));
+    }
+
+    void Repeat(Milliseconds time) { ScheduleEvent(_lastEvent, time); }
+    void Repeat(Milliseconds minTime, Milliseconds maxTime) { ScheduleEvent(_lastEvent, minTime, maxTime); }
+
+    void CancelEvent(uint32 eventId)
+    {
+        for (uint8 i = 0; i < _count;)
+        {
+            if (_events[i].eventId == eventId)
+                _events[i] = _events[--_count];
+            else
+                ++i;
+        }
+    }
+
+    uint32 ExecuteEvent()
+    {
+        uint8 earliest = _count;
+        for (uint8 i = 0; i < _count; ++i)
+            if (_events[i].time <= _time && (earliest == _count || _events[i].time < _events[earliest].time))
+                earliest = i;
+
+        if (earliest == _count)
+            return 0;
+
+        _lastEvent = _events[earliest].eventId;
+        _events[earliest] = _events[--_count];
+        return _lastEvent;
+    }
+
+    bool Empty() const { return !_count; }
+
+private:
+    static constexpr uint8 EventMapCapacity = 32;
+
+    struct ScheduledEvent
+    {
+        uint32 time;
+        uint32 eventId;
+    };
+
+    std::array<ScheduledEvent, EventMapCapacity> _events{};
+    uint32 _time{};
+    uint32 _lastEvent{};
+    uint8 _count{};
+};
+
+#endif
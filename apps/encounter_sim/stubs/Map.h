@@ -0,0 +1,48 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Stand-in for the AzerothCore header of the same name, only the player list
+#ifndef ENCOUNTER_SIM_MAP_H
+#define ENCOUNTER_SIM_MAP_H
+
+#include "Player.h"
+#include <vector>
+
+class MapReference
+{
+public:
+    explicit MapReference(Player* player) : _player(player) { }
+
+    Player* GetSource() const { return _player; }
+
+private:
+    Player* _player;
+};
+
+class Map
+{
+public:
+    typedef std::vector<MapReference> PlayerList;
+
+    PlayerList const& GetPlayers() const { return _players; }
+    void AddPlayer(Player* player) { _players.emplace_back(player); }
+
+private:
+    PlayerList _players;
+};
+
+#endif
@@ -0,0 +1,46 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Stand-in for the AzerothCore header of the same name, only what the module headers use
+#ifndef ENCOUNTER_SIM_OBJECTGUID_H
+#define ENCOUNTER_SIM_OBJECTGUID_H
+
+#include "Define.h"
+#include <functional>
+
+class ObjectGuid
+{
+public:
+    ObjectGuid() = default;
+    explicit ObjectGuid(uint64 raw) : _raw(raw) { }
+
+    uint64 GetRawValue() const { return _raw; }
+    bool IsEmpty() const { return !_raw; }
+
+    bool operator==(ObjectGuid const& other) const = default;
+
+private:
+    uint64 _raw{};
+};
+
+template<>
+struct std::hash<ObjectGuid>
+{
+    std::size_t operator()(ObjectGuid const& guid) const { return std::hash<uint64>()(guid.GetRawValue()); }
+};
+
+#endif
@@ -0,0 +1,52 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Stand-in for the AzerothCore header of the same name
+#ifndef ENCOUNTER_SIM_PLAYER_H
+#define ENCOUNTER_SIM_PLAYER_H
+
+#include "Unit.h"
+
+enum Classes : uint8
+{
+    CLASS_WARRIOR       = 1,
+    CLASS_PALADIN       = 2,
+    CLASS_HUNTER        = 3,
+    CLASS_ROGUE         = 4,
+    CLASS_PRIEST        = 5,
+    CLASS_SHAMAN        = 7,
+    CLASS_MAGE          = 8,
+    CLASS_WARLOCK       = 9,
+    CLASS_DRUID         = 11
+};
+
+class Player : public Unit
+{
+public:
+    Player(ObjectGuid guid, uint8 classId) : Unit(guid, true), _classId(classId) { }
+
+    uint8 getClass() const { return _classId; }
+
+    bool IsGameMaster() const { return _gameMaster; }
+    void SetGameMaster(bool on) { _gameMaster = on; }
+
+private:
+    uint8 _classId;
+    bool _gameMaster{};
+};
+
+#endif
@@ -0,0 +1,56 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Stand-in for the AzerothCore header of the same name, seeded by the simulator so that runs repeat
+#ifndef ENCOUNTER_SIM_RANDOM_H
+#define ENCOUNTER_SIM_RANDOM_H
+
+#include "Define.h"
+#include <random>
+
+inline std::mt19937& GetSimulatorRandomEngine()
+{
+    static std::mt19937 engine(5489u);
+    return engine;
+}
+
+inline void SetSimulatorRandomSeed(uint32 seed)
+{
+    GetSimulatorRandomEngine().seed(seed);
+}
+
+inline uint32 urand(uint32 min, uint32 max)
+{
+    return std::uniform_int_distribution<uint32>(min, max)(GetSimulatorRandomEngine());
+}
+
+inline int32 irand(int32 min, int32 max)
+{
+    return std::uniform_int_distribution<int32>(min, max)(GetSimulatorRandomEngine());
+}
+
+inline float frand(float min, float max)
+{
+    return std::uniform_real_distribution<float>(min, max)(GetSimulatorRandomEngine());
+}
+
+inline bool roll_chance_i(int32 chance)
+{
+    return chance > irand(0, 99);
+}
+
+#endif
@@ -0,0 +1,129 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Stand-in for the AzerothCore header of the same name. The threat list is a std::list of
+// references sorted by threat, like ThreatContainer, so selections walk the same structure.
+#ifndef ENCOUNTER_SIM_THREATMGR_H
+#define ENCOUNTER_SIM_THREATMGR_H
+
+#include "Define.h"
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <vector>
+
+class Unit;
+
+class HostileReference
+{
+public:
+    explicit HostileReference(Unit* target) : _target(target) { }
+
+    Unit* getTarget() const { return _target; }
+    float getThreat() const { return _threat; }
+    void addThreat(float threat) { _threat = std::max(0.0f, _threat + threat); }
+
+private:
+    Unit* _target;
+    float _threat{};
+};
+
+class ThreatMgr
+{
+public:
+    typedef std::list<HostileReference*> StorageType;
+
+    // Returns the list sorted as of the last Update, like the real threat container
+    StorageType const& GetThreatList() const { return _threatList; }
+    bool IsThreatListEmpty() const { return _threatList.empty(); }
+
+    HostileReference* getCurrentVictim() const { return _currentVictim; }
+
+    void AddThreat(Unit* victim, float threat)
+    {
+        HostileReference* ref = GetReference(victim);
+        if (!ref)
+        {
+            _references.push_back(std::make_unique<HostileReference>(victim));
+            ref = _references.back().get();
+            _threatList.push_back(ref);
+        }
+
+        ref->addThreat(threat);
+        _dirty = true;
+    }
+
+    // Drops a dead or departed target from the list
+    void RemoveTarget(Unit* victim)
+    {
+        HostileReference* ref = GetReference(victim);
+        if (!ref)
+            return;
+
+        _threatList.remove(ref);
+        if (_currentVictim == ref)
+            _currentVictim = nullptr;
+    }
+
+    HostileReference* GetReference(Unit* victim) const
+    {
+        for (HostileReference* ref : _threatList)
+            if (ref->getTarget() == victim)
+                return ref;
+
+        return nullptr;
+    }
+
+    // Sorts the list when threat changed and picks the victim, the current one is kept
+    // until another target goes 10% above it, as ThreatContainer::SelectNextVictim does in melee range
+    void Update()
+    {
+        if (_dirty)
+        {
+            _threatList.sort([](HostileReference const* left, HostileReference const* right) { return left->getThreat() > right->getThreat(); });
+            _dirty = false;
+        }
+
+        if (_threatList.empty())
+        {
+            _currentVictim = nullptr;
+            return;
+        }
+
+        HostileReference* top = _threatList.front();
+        if (!_currentVictim || top->getThreat() > _currentVictim->getThreat() * 1.1f)
+            _currentVictim = top;
+    }
+
+    void SetCurrentVictim(HostileReference* ref) { _currentVictim = ref; }
+
+    void ClearReferences()
+    {
+        _threatList.clear();
+        _references.clear();
+        _currentVictim = nullptr;
+        _dirty = false;
+    }
+
+private:
+    StorageType _threatList;
+    std::vector<std::unique_ptr<HostileReference>> _references;
+    HostileReference* _currentVictim{};
+    bool _dirty{};
+};
+
+#endif
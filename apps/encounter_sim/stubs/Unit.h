@@ -0,0 +1,198 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Stand-in for the AzerothCore header of the same name, the unit state the module kernels read
+#ifndef ENCOUNTER_SIM_UNIT_H
+#define ENCOUNTER_SIM_UNIT_H
+
+#include "Define.h"
+#include "ObjectGuid.h"
+#include "ThreatMgr.h"
+#include <algorithm>
+#include <array>
+
+static constexpr float NOMINAL_MELEE_RANGE = 5.0f;
+static constexpr float DEFAULT_COMBAT_REACH = 1.5f;
+
+enum Powers : int8
+{
+    POWER_MANA      = 0,
+    POWER_RAGE      = 1,
+    POWER_FOCUS     = 2,
+    POWER_ENERGY    = 3
+};
+
+struct Position
+{
+    Position(float x = 0.0f, float y = 0.0f, float z = 0.0f, float o = 0.0f) : m_positionX(x), m_positionY(y), m_positionZ(z), m_orientation(o) { }
+
+    float m_positionX;
+    float m_positionY;
+    float m_positionZ;
+    float m_orientation;
+
+    float GetPositionX() const { return m_positionX; }
+    float GetPositionY() const { return m_positionY; }
+    float GetPositionZ() const { return m_positionZ; }
+    float GetOrientation() const { return m_orientation; }
+
+    void Relocate(float x, float y, float z)
+    {
+        m_positionX = x;
+        m_positionY = y;
+        m_positionZ = z;
+    }
+
+    float GetExactDistSq(Position const* pos) const
+    {
+        float dx = m_positionX - pos->m_positionX;
+        float dy = m_positionY - pos->m_positionY;
+        float dz = m_positionZ - pos->m_positionZ;
+        return dx * dx + dy * dy + dz * dz;
+    }
+};
+
+class WorldObject : public Position
+{
+public:
+    explicit WorldObject(ObjectGuid guid) : _guid(guid) { }
+
+    ObjectGuid GetGUID() const { return _guid; }
+    float GetObjectSize() const { return DEFAULT_COMBAT_REACH; }
+    float GetCombatReach() const { return DEFAULT_COMBAT_REACH; }
+
+    bool IsWithinDist(WorldObject const* obj, float dist) const
+    {
+        float maxDist = dist + GetObjectSize() + obj->GetObjectSize();
+        return GetExactDistSq(obj) < maxDist * maxDist;
+    }
+
+private:
+    ObjectGuid _guid;
+};
+
+// A unit holds up to this many auras at once, the encounters apply a handful
+static constexpr uint8 UnitMaxAuras = 8;
+
+class Unit : public WorldObject
+{
+public:
+    Unit(ObjectGuid guid, bool isPlayer) : WorldObject(guid), _isPlayer(isPlayer) { }
+
+    bool IsPlayer() const { return _isPlayer; }
+
+    bool IsAlive() const { return _alive; }
+    void SetAlive(bool alive) { _alive = alive; }
+
+    uint32 GetHealth() const { return _health; }
+    uint32 GetMaxHealth() const { return _maxHealth; }
+    void SetMaxHealth(uint32 health) { _maxHealth = _health = health; }
+    void SetHealth(uint32 health) { _health = std::min(health, _maxHealth); }
+
+    Powers getPowerType() const { return _powerType; }
+    void setPowerType(Powers power) { _powerType = power; }
+    uint32 GetPower(Powers power) const { return power == _powerType ? _power : 0; }
+    void SetPower(uint32 power) { _power = power; }
+
+    // Auras are ids with a duration, counted down by UpdateAuras
+    bool HasAura(uint32 spellId) const
+    {
+        return std::any_of(_auras.begin(), _auras.begin() + _auraCount, [spellId](AuraSlot const& aura) { return aura.spellId == spellId; });
+    }
+
+    void AddAura(uint32 spellId, uint32 durationMs)
+    {
+        for (uint8 i = 0; i < _auraCount; ++i)
+        {
+            if (_auras[i].spellId == spellId)
+            {
+                _auras[i].remaining = durationMs;
+                return;
+            }
+        }
+
+        if (_auraCount < UnitMaxAuras)
+            _auras[_auraCount++] = { spellId, durationMs };
+    }
+
+    void RemoveAurasDueToSpell(uint32 spellId)
+    {
+        for (uint8 i = 0; i < _auraCount;)
+        {
+            if (_auras[i].spellId == spellId)
+                _auras[i] = _auras[--_auraCount];
+            else
+                ++i;
+        }
+    }
+
+    void RemoveAllAuras() { _auraCount = 0; }
+
+    void UpdateAuras(uint32 diff)
+    {
+        for (uint8 i = 0; i < _auraCount;)
+        {
+            if (_auras[i].remaining <= diff)
+                _auras[i] = _auras[--_auraCount];
+            else
+            {
+                _auras[i].remaining -= diff;
+                ++i;
+            }
+        }
+    }
+
+    ThreatMgr& GetThreatMgr() { return _threatMgr; }
+    void AddThreat(Unit* victim, float threat) { _threatMgr.AddThreat(victim, threat); }
+
+    Unit* GetVictim() const
+    {
+        HostileReference* victim = _threatMgr.getCurrentVictim();
+        return victim ? victim->getTarget() : nullptr;
+    }
+
+    bool IsWithinCombatRange(Unit const* obj, float dist) const
+    {
+        float maxDist = dist + GetCombatReach() + obj->GetCombatReach();
+        return GetExactDistSq(obj) < maxDist * maxDist;
+    }
+
+    bool IsWithinMeleeRange(Unit const* obj) const
+    {
+        float maxDist = std::max(NOMINAL_MELEE_RANGE, GetCombatReach() + obj->GetCombatReach() + 4.0f / 3.0f);
+        return GetExactDistSq(obj) < maxDist * maxDist;
+    }
+
+private:
+    struct AuraSlot
+    {
+        uint32 spellId;
+        uint32 remaining;
+    };
+
+    ThreatMgr _threatMgr;
+    std::array<AuraSlot, UnitMaxAuras> _auras{};
+    uint32 _health{ 1 };
+    uint32 _maxHealth{ 1 };
+    uint32 _power{};
+    Powers _powerType{ POWER_MANA };
+    uint8 _auraCount{};
+    bool _isPlayer;
+    bool _alive{ true };
+};
+
+#endif
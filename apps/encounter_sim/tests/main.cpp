@@ -0,0 +1,63 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sim_test.h"
+#include "Random.h"
+#include <cstdio>
+#include <cstring>
+
+static bool SimTestFailed = false;
+
+std::vector<SimTest>& GetSimTests()
+{
+    static std::vector<SimTest> tests;
+    return tests;
+}
+
+void ReportSimTestFailure(char const* file, int line, char const* expression)
+{
+    std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+    SimTestFailed = true;
+}
+
+// encounter_sim_tests [GROUP], runs every test of the group or all of them
+int main(int argc, char** argv)
+{
+    char const* group = argc > 1 ? argv[1] : nullptr;
+    uint32 run = 0;
+    for (SimTest const& test : GetSimTests())
+    {
+        if (group && std::strcmp(group, test.group))
+            continue;
+
+        SetSimulatorRandomSeed(1);
+        bool failedBefore = SimTestFailed;
+        SimTestFailed = false;
+        test.fn();
+        std::printf("%s %s.%s\n", SimTestFailed ? "FAIL" : "ok  ", test.group, test.name);
+        SimTestFailed |= failedBefore;
+        ++run;
+    }
+
+    if (!run)
+    {
+        std::fprintf(stderr, "no test in group %s\n", group ? group : "");
+        return 1;
+    }
+
+    return SimTestFailed ? 1 : 0;
+}
@@ -0,0 +1,116 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "naxxramas_40_polarity.h"
+#include "sim_test.h"
+
+static constexpr uint32 SPELL_POSITIVE_POLARITY = 28059;
+static constexpr uint32 SPELL_NEGATIVE_POLARITY = 28084;
+static constexpr float ChargeRadius = 13.0f;
+
+// Thaddius' platform with the raid spread over it and a random charge on everyone
+class PolarityFixture
+{
+public:
+    PolarityFixture()
+    {
+        for (uint32 i = 0; i < 40; ++i)
+        {
+            auto player = std::make_unique<Player>(ObjectGuid(i + 1), CLASS_MAGE);
+            player->Relocate(3508.0f + frand(-40.0f, 40.0f), -2930.0f + frand(-40.0f, 40.0f), 302.0f);
+            player->AddAura(urand(0, 1) ? SPELL_POSITIVE_POLARITY : SPELL_NEGATIVE_POLARITY, 60000);
+            roster.Add(player.get());
+            players.push_back(std::move(player));
+        }
+    }
+
+    // What the charge spell counted before the grid, an aura check on every player in range
+    uint32 CountNearBruteForce(Player const* caster, bool positive) const
+    {
+        uint32 count = 0;
+        for (auto const& player : players)
+            if (player.get() != caster && player->IsAlive() && player->HasAura(positive ? SPELL_POSITIVE_POLARITY : SPELL_NEGATIVE_POLARITY) && caster->IsWithinDist(player.get(), ChargeRadius))
+                ++count;
+
+        return count;
+    }
+
+    RaidRoster roster;
+    std::vector<std::unique_ptr<Player>> players;
+};
+
+SIM_TEST(polarity_grid, counts_match_brute_force)
+{
+    for (uint32 trial = 0; trial < 200; ++trial)
+    {
+        PolarityFixture fixture;
+        PolarityGrid grid;
+        grid.Activate(SPELL_POSITIVE_POLARITY, SPELL_NEGATIVE_POLARITY);
+        grid.Refresh(fixture.roster, trial);
+
+        for (auto const& player : fixture.players)
+        {
+            // IsWithinDist adds the caster's size, the grid the target's, both are the default
+            bool positive = player->HasAura(SPELL_POSITIVE_POLARITY);
+            SIM_CHECK(grid.CountNear(player.get(), positive, ChargeRadius + player->GetObjectSize()) == fixture.CountNearBruteForce(player.get(), positive));
+        }
+    }
+}
+
+SIM_TEST(polarity_grid, builds_once_per_pulse)
+{
+    PolarityFixture fixture;
+    PolarityGrid grid;
+    grid.Activate(SPELL_POSITIVE_POLARITY, SPELL_NEGATIVE_POLARITY);
+
+    Player* caster = fixture.players[0].get();
+    bool positive = caster->HasAura(SPELL_POSITIVE_POLARITY);
+    float reach = ChargeRadius + caster->GetObjectSize();
+    grid.Refresh(fixture.roster, 1000);
+    uint32 before = grid.CountNear(caster, positive, reach);
+
+    // Everyone else joins the caster with the same charge
+    for (auto const& player : fixture.players)
+    {
+        player->RemoveAllAuras();
+        player->AddAura(positive ? SPELL_POSITIVE_POLARITY : SPELL_NEGATIVE_POLARITY, 60000);
+        player->Relocate(caster->GetPositionX(), caster->GetPositionY(), caster->GetPositionZ());
+    }
+
+    // The other charge spells of the same update keep the grid of the first one
+    grid.Refresh(fixture.roster, 1000);
+    SIM_CHECK(grid.CountNear(caster, positive, reach) == before);
+
+    // The next pulse sees the new positions
+    grid.Refresh(fixture.roster, 6000);
+    SIM_CHECK(grid.CountNear(caster, positive, reach) == 39);
+}
+
+SIM_TEST(polarity_grid, clear_deactivates)
+{
+    PolarityFixture fixture;
+    PolarityGrid grid;
+    SIM_CHECK(!grid.IsActive());
+
+    grid.Activate(SPELL_POSITIVE_POLARITY, SPELL_NEGATIVE_POLARITY);
+    SIM_CHECK(grid.IsActive());
+
+    grid.Refresh(fixture.roster, 1);
+    grid.Clear();
+    SIM_CHECK(!grid.IsActive());
+    SIM_CHECK(grid.CountNear(fixture.players[0].get(), true, ChargeRadius) == 0);
+}
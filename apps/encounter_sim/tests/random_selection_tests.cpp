@@ -0,0 +1,140 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "allocation_counter.h"
+#include "naxxramas_40_targeting.h"
+#include "sim_test.h"
+#include <iterator>
+#include <unordered_map>
+#include <vector>
+
+static constexpr uint32 RandomSelectionDraws = 200000;
+static constexpr uint32 SPELL_CHAINS_OF_KELTHUZAD = 28410;
+
+// Pearson's chi-squared statistic of observed counts against the same expected count for each
+static double ChiSquared(std::unordered_map<Unit*, uint32> const& counts, std::size_t categories, double expected)
+{
+    double chiSquared = 0.0;
+    for (auto const& [target, count] : counts)
+        chiSquared += (count - expected) * (count - expected) / expected;
+
+    // Targets never drawn are missing from counts
+    chiSquared += (categories - counts.size()) * expected;
+    return chiSquared;
+}
+
+// Critical values of the chi-squared distribution at p = 0.001, the draws are seeded
+// so a run either always passes or always fails
+static constexpr double ChiSquared38Critical = 70.70;
+static constexpr double ChiSquared39Critical = 72.05;
+
+SIM_TEST(random_selection, single_target_is_uniform)
+{
+    ThreatListFixture fixture(40);
+    std::unordered_map<Unit*, uint32> counts;
+    for (uint32 i = 0; i < RandomSelectionDraws; ++i)
+        ++counts[SelectRandomThreatTarget(fixture.boss.GetThreatMgr(), NaxxTarget::IsPlayer())];
+
+    SIM_CHECK(counts.size() == 40);
+    SIM_CHECK(ChiSquared(counts, 40, RandomSelectionDraws / 40.0) < ChiSquared39Critical);
+}
+
+SIM_TEST(random_selection, three_targets_are_uniform_and_distinct)
+{
+    ThreatListFixture fixture(40);
+    std::unordered_map<Unit*, uint32> counts;
+    for (uint32 i = 0; i < RandomSelectionDraws; ++i)
+    {
+        FixedVector<Unit*, 3> targets = SelectRandomThreat<3>(fixture.boss.GetThreatMgr(), 3, NaxxTarget::IsPlayer());
+        SIM_CHECK(targets.size() == 3);
+        SIM_CHECK(targets[0] != targets[1] && targets[0] != targets[2] && targets[1] != targets[2]);
+        for (Unit* target : targets)
+            ++counts[target];
+    }
+
+    // Every player is one of the three picks with the same probability, 3 / 40
+    SIM_CHECK(ChiSquared(counts, 40, RandomSelectionDraws * 3 / 40.0) < ChiSquared39Critical);
+}
+
+SIM_TEST(random_selection, skip_excludes_current_victim)
+{
+    ThreatListFixture fixture(40);
+    ThreatMgr& threatMgr = fixture.boss.GetThreatMgr();
+
+    // The victim is kept below the top of the list, as the 110% rule allows, so skipping by
+    // threat order alone would exclude the wrong player
+    auto itr = std::next(threatMgr.GetThreatList().begin(), 5);
+    threatMgr.SetCurrentVictim(*itr);
+    Unit* victim = fixture.boss.GetVictim();
+    Unit* top = threatMgr.GetThreatList().front()->getTarget();
+    SIM_CHECK(victim != top);
+
+    std::unordered_map<Unit*, uint32> counts;
+    for (uint32 i = 0; i < RandomSelectionDraws; ++i)
+    {
+        for (Unit* target : SelectRandomThreat<3>(threatMgr, 3, NaxxTarget::IsPlayer(), 1))
+        {
+            SIM_CHECK(target != victim);
+            ++counts[target];
+        }
+    }
+
+    SIM_CHECK(!counts.count(victim));
+    SIM_CHECK(counts.count(top));
+    SIM_CHECK(ChiSquared(counts, 39, RandomSelectionDraws * 3 / 39.0) < ChiSquared38Critical);
+
+    counts.clear();
+    for (uint32 i = 0; i < RandomSelectionDraws; ++i)
+        ++counts[SelectRandomThreatTarget(threatMgr, NaxxTarget::IsPlayer(), 1)];
+
+    SIM_CHECK(!counts.count(victim));
+    SIM_CHECK(ChiSquared(counts, 39, RandomSelectionDraws / 39.0) < ChiSquared38Critical);
+}
+
+SIM_TEST(random_selection, skip_without_matching_victim)
+{
+    // The victim does not match, the skip falls on the most hated matching target instead
+    ThreatListFixture fixture(40);
+    ThreatMgr& threatMgr = fixture.boss.GetThreatMgr();
+    Unit* victim = fixture.boss.GetVictim();
+    victim->AddAura(SPELL_CHAINS_OF_KELTHUZAD, 20000);
+
+    std::vector<Unit*> matching;
+    for (HostileReference* ref : threatMgr.GetThreatList())
+        if (!ref->getTarget()->HasAura(SPELL_CHAINS_OF_KELTHUZAD))
+            matching.push_back(ref->getTarget());
+
+    for (uint32 i = 0; i < 10000; ++i)
+    {
+        Unit* target = SelectRandomThreatTarget(threatMgr, NaxxTarget::NotAura{ SPELL_CHAINS_OF_KELTHUZAD }, 1);
+        SIM_CHECK(target != victim);
+        SIM_CHECK(target != matching.front());
+    }
+}
+
+SIM_TEST(random_selection, allocates_nothing)
+{
+    ThreatListFixture fixture(40);
+    Unit* me = &fixture.boss;
+    AllocationScope allocations;
+    FixedVector<Unit*, 3> targets = SelectRandomThreat<3>(me->GetThreatMgr(), 3,
+        NaxxTarget::AllOf(NaxxTarget::IsPlayer(), NaxxTarget::InRange{ me, 200.0f }, NaxxTarget::NotAura{ SPELL_CHAINS_OF_KELTHUZAD }), 1);
+    Unit* mana = SelectRandomThreatTarget(me->GetThreatMgr(), NaxxTarget::AllOf(NaxxTarget::IsPlayer(), NaxxTarget::HasPower{ POWER_MANA }));
+    SIM_CHECK(allocations.GetCount() == 0);
+    SIM_CHECK(targets.size() == 3);
+    SIM_CHECK(mana == nullptr); // the fixture is warriors only
+}
@@ -0,0 +1,75 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ENCOUNTER_SIM_TEST_H
+#define ENCOUNTER_SIM_TEST_H
+
+#include "Player.h"
+#include "Random.h"
+#include <memory>
+#include <vector>
+
+// Minimal test registry of the simulator, tests are grouped so that ctest can run a group at a time
+struct SimTest
+{
+    char const* group;
+    char const* name;
+    void (*fn)();
+};
+
+std::vector<SimTest>& GetSimTests();
+void ReportSimTestFailure(char const* file, int line, char const* expression);
+
+struct SimTestRegistrar
+{
+    SimTestRegistrar(char const* group, char const* name, void (*fn)()) { GetSimTests().push_back({ group, name, fn }); }
+};
+
+#define SIM_TEST(group, name) \
+    static void group##_##name(); \
+    static SimTestRegistrar group##_##name##_registrar(#group, #name, group##_##name); \
+    static void group##_##name()
+
+#define SIM_CHECK(expression) \
+    do { if (!(expression)) ReportSimTestFailure(__FILE__, __LINE__, #expression); } while (0)
+
+// A boss with count players on its threat list, sorted like the threat container after its update.
+// Threat values are drawn from a small range so that ties occur, positions put about half of
+// the players in melee range.
+class ThreatListFixture
+{
+public:
+    explicit ThreatListFixture(uint32 count) : boss(ObjectGuid(uint64(1) << 48), false)
+    {
+        for (uint32 i = 0; i < count; ++i)
+        {
+            auto player = std::make_unique<Player>(ObjectGuid(i + 1), CLASS_WARRIOR);
+            float distance = frand(0.0f, 10.0f);
+            player->Relocate(distance, 0.0f, 0.0f);
+            player->SetMaxHealth(urand(3000, 9000));
+            boss.AddThreat(player.get(), float(urand(0, 50) * 100));
+            players.push_back(std::move(player));
+        }
+
+        boss.GetThreatMgr().Update();
+    }
+
+    Unit boss;
+    std::vector<std::unique_ptr<Player>> players;
+};
+
+#endif
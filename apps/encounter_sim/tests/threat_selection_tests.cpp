@@ -0,0 +1,72 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "allocation_counter.h"
+#include "sim_test.h"
+#include "threat_selection.h"
+#include <algorithm>
+
+SIM_TEST(threat_selection, top_threat_matches_sort)
+{
+    for (uint32 trial = 0; trial < 1000; ++trial)
+    {
+        ThreatListFixture fixture(urand(40, 80));
+        Unit* me = &fixture.boss;
+        auto inMelee = [me](Unit* target) { return me->IsWithinMeleeRange(target); };
+
+        FixedVector<Unit*, 3> top = SelectTopThreat<3>(me->GetThreatMgr(), inMelee);
+        std::vector<Unit*> expected = SortBasedTopThreat(me->GetThreatMgr(), 3, inMelee);
+        SIM_CHECK(std::equal(top.begin(), top.end(), expected.begin(), expected.end()));
+
+        FixedVector<Unit*, 3> any = SelectTopThreat<3>(me->GetThreatMgr());
+        expected = SortBasedTopThreat(me->GetThreatMgr(), 3, [](Unit*) { return true; });
+        SIM_CHECK(std::equal(any.begin(), any.end(), expected.begin(), expected.end()));
+    }
+}
+
+SIM_TEST(threat_selection, top_threat_short_lists)
+{
+    // Fewer matching targets than asked for, down to none
+    for (uint32 count = 0; count < 6; ++count)
+    {
+        ThreatListFixture fixture(count);
+        Unit* me = &fixture.boss;
+        auto inMelee = [me](Unit* target) { return me->IsWithinMeleeRange(target); };
+
+        FixedVector<Unit*, 3> top = SelectTopThreat<3>(me->GetThreatMgr(), inMelee);
+        std::vector<Unit*> expected = SortBasedTopThreat(me->GetThreatMgr(), 3, inMelee);
+        SIM_CHECK(std::equal(top.begin(), top.end(), expected.begin(), expected.end()));
+    }
+}
+
+SIM_TEST(threat_selection, hateful_strike_matches_list_walk)
+{
+    for (uint32 trial = 0; trial < 1000; ++trial)
+    {
+        ThreatListFixture fixture(urand(1, 80));
+        SIM_CHECK(TopThreatHatefulStrikeTarget(&fixture.boss) == ListWalkHatefulStrikeTarget(&fixture.boss));
+    }
+}
+
+SIM_TEST(threat_selection, top_threat_allocates_nothing)
+{
+    ThreatListFixture fixture(80);
+    AllocationScope allocations;
+    Unit* target = TopThreatHatefulStrikeTarget(&fixture.boss);
+    SIM_CHECK(allocations.GetCount() == 0);
+    SIM_CHECK(target == ListWalkHatefulStrikeTarget(&fixture.boss));
+}
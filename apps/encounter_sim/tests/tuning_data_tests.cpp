@@ -0,0 +1,79 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "naxxramas_40_tuning_data.h"
+#include "sim_test.h"
+#include <fstream>
+#include <regex>
+#include <string>
+
+// The base SQL of naxx40_encounter_tuning holds the same values as the compiled defaults,
+// so a fresh database and a server without the table play the same encounters
+SIM_TEST(tuning_data, sql_matches_compiled_defaults)
+{
+    std::ifstream sql(NAXX40_TUNING_SQL);
+    SIM_CHECK(sql.is_open());
+
+    //                          TuningId  SpellId   MinValue    MaxValue
+    std::regex const row(R"(^\((\d+), (\d+), (-?\d+), (-?\d+), '.*'\)[,;]$)");
+    std::regex const cleanup(R"(^DELETE FROM `naxx40_encounter_tuning` WHERE `TuningId` BETWEEN 0 AND (\d+);$)");
+
+    std::array<uint32, MAX_NAXX40_TUNING> rows{};
+    uint32 cleanupMax = 0;
+    std::string line;
+    std::smatch match;
+    while (std::getline(sql, line))
+    {
+        if (std::regex_match(line, match, cleanup))
+        {
+            cleanupMax = std::stoul(match[1]);
+            continue;
+        }
+
+        if (!std::regex_match(line, match, row))
+            continue;
+
+        uint32 id = std::stoul(match[1]);
+        SIM_CHECK(id < MAX_NAXX40_TUNING);
+        if (id >= MAX_NAXX40_TUNING)
+            continue;
+
+        ++rows[id];
+        Naxx40TuningEntry const& entry = Naxx40TuningDefaults[id];
+        SIM_CHECK(uint32(std::stoul(match[2])) == entry.spellId);
+        SIM_CHECK(std::stol(match[3]) == entry.minValue);
+        SIM_CHECK(std::stol(match[4]) == entry.maxValue);
+    }
+
+    // One row per id, and the cleanup covers them all
+    for (uint32 count : rows)
+        SIM_CHECK(count == 1);
+
+    SIM_CHECK(cleanupMax == MAX_NAXX40_TUNING - 1);
+}
+
+SIM_TEST(tuning_data, compiled_defaults_are_valid)
+{
+    for (Naxx40TuningEntry const& entry : Naxx40TuningDefaults)
+    {
+        SIM_CHECK(entry.spellId);
+        SIM_CHECK(entry.minValue <= entry.maxValue);
+
+        int32 value = entry.Roll();
+        SIM_CHECK(value >= entry.minValue && value <= entry.maxValue);
+    }
+}
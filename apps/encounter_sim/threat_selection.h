@@ -0,0 +1,91 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ENCOUNTER_SIM_THREAT_SELECTION_H
+#define ENCOUNTER_SIM_THREAT_SELECTION_H
+
+#include "naxxramas_40_targeting.h"
+#include <algorithm>
+#include <list>
+#include <vector>
+
+// The selection SelectTopThreat replaced: copy the threat list, sort it by threat and keep
+// the first k targets that match pred
+template<typename Predicate>
+std::vector<Unit*> SortBasedTopThreat(ThreatMgr& threatMgr, std::size_t k, Predicate pred)
+{
+    std::vector<HostileReference*> sorted(threatMgr.GetThreatList().begin(), threatMgr.GetThreatList().end());
+    std::stable_sort(sorted.begin(), sorted.end(), [](HostileReference const* left, HostileReference const* right) { return left->getThreat() > right->getThreat(); });
+
+    std::vector<Unit*> targets;
+    for (HostileReference* ref : sorted)
+        if (targets.size() < k && pred(ref->getTarget()))
+            targets.push_back(ref->getTarget());
+
+    return targets;
+}
+
+// Hateful Strike target as boss_patchwerk_40 picked it before, gathering the melee range
+// targets of the whole threat list into a std::list
+inline Unit* ListWalkHatefulStrikeTarget(Unit* me)
+{
+    std::list<Unit*> meleeRangeTargets;
+    for (HostileReference* ref : me->GetThreatMgr().GetThreatList())
+        if (me->IsWithinMeleeRange(ref->getTarget()))
+            meleeRangeTargets.push_back(ref->getTarget());
+
+    Unit* finalTarget = nullptr;
+    uint8 counter = 0;
+    for (auto itr = meleeRangeTargets.begin(); itr != meleeRangeTargets.end(); ++itr, ++counter)
+    {
+        if (meleeRangeTargets.size() == 1)
+            finalTarget = *itr;
+        else if (counter > 0)
+        {
+            if (!finalTarget || (*itr)->GetHealth() > finalTarget->GetHealth())
+                finalTarget = *itr;
+
+            if (counter >= 2)
+                break;
+        }
+    }
+
+    return finalTarget;
+}
+
+// Hateful Strike target as boss_patchwerk_40 picks it now
+inline Unit* TopThreatHatefulStrikeTarget(Unit* me)
+{
+    FixedVector<Unit*, 3> meleeRangeTargets = SelectTopThreat<3>(me->GetThreatMgr(), [me](Unit* target)
+    {
+        return me->IsWithinMeleeRange(target);
+    });
+
+    Unit* finalTarget = nullptr;
+    if (meleeRangeTargets.size() == 1)
+        finalTarget = meleeRangeTargets[0];
+    else
+    {
+        for (std::size_t i = 1; i < meleeRangeTargets.size(); ++i)
+            if (!finalTarget || meleeRangeTargets[i]->GetHealth() > finalTarget->GetHealth())
+                finalTarget = meleeRangeTargets[i];
+    }
+
+    return finalTarget;
+}
+
+#endif
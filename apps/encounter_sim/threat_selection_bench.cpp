@@ -0,0 +1,61 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Hateful Strike target selection on threat lists of 40 to 80 entries: the std::list walk
+// boss_patchwerk_40 used before against SelectTopThreat.
+//
+// threat_selection_bench [ITERATIONS]
+
+#include "Random.h"
+#include "allocation_counter.h"
+#include "tests/sim_test.h"
+#include "threat_selection.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+template<typename Select>
+static void Measure(char const* name, uint32 count, uint32 iterations, Unit* me, Select select)
+{
+    Unit* sink = nullptr;
+    AllocationScope allocations;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32 i = 0; i < iterations; ++i)
+    {
+        Unit* target = select(me);
+        sink = target ? target : sink;
+    }
+    double nanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    std::printf("%-12s %8u %14.1f %16.2f%s\n", name, count, nanos / iterations, double(allocations.GetCount()) / iterations, sink ? "" : " (no target)");
+}
+
+int main(int argc, char** argv)
+{
+    uint32 iterations = argc > 1 ? uint32(std::max(1, std::atoi(argv[1]))) : 200000;
+
+    std::printf("%-12s %8s %14s %16s\n", "Selection", "entries", "ns/selection", "allocs/selection");
+    for (uint32 count : { 40, 60, 80 })
+    {
+        SetSimulatorRandomSeed(count);
+        ThreatListFixture fixture(count);
+        Measure("list walk", count, iterations, &fixture.boss, ListWalkHatefulStrikeTarget);
+        Measure("top threat", count, iterations, &fixture.boss, TopThreatHatefulStrikeTarget);
+    }
+
+    return 0;
+}
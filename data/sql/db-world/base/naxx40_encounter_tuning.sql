@@ -0,0 +1,49 @@
+-- Damage values of the Naxx40 encounters, loaded at startup and by `.reload naxx40_tuning`.
+-- TuningId is the dense id of Naxx40TuningId (naxxramas_40_tuning_data.h), SpellId is informative.
+-- The rows match the compiled defaults of that header, the encounter simulator tests check it.
+-- Fixed values use MinValue = MaxValue. Ids without a row keep their compiled default.
+CREATE TABLE IF NOT EXISTS `naxx40_encounter_tuning` (
+  `TuningId` TINYINT UNSIGNED NOT NULL,
+  `SpellId` INT UNSIGNED NOT NULL DEFAULT 0,
+  `MinValue` INT NOT NULL DEFAULT 0,
+  `MaxValue` INT NOT NULL DEFAULT 0,
+  `Comment` VARCHAR(255) NOT NULL DEFAULT '',
+  PRIMARY KEY (`TuningId`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COLLATE=utf8mb4_unicode_ci;
+
+DELETE FROM `naxx40_encounter_tuning` WHERE `TuningId` BETWEEN 0 AND 33;
+INSERT INTO `naxx40_encounter_tuning` (`TuningId`, `SpellId`, `MinValue`, `MaxValue`, `Comment`) VALUES
+(0, 41926, 22100, 22850, 'Patchwerk - Hateful Strike'),
+(1, 28157, 3200, 4800, 'Grobbulus - Slime Spray'),
+(2, 28206, 2379, 2379, 'Grobbulus - Mutating Explosion'),
+(3, 28241, 1110, 1290, 'Grobbulus - Poison Cloud'),
+(4, 28167, 1850, 1850, 'Thaddius - Chain Lightning, base points of a (1850, 2150) roll'),
+(5, 28299, 6000, 6000, 'Thaddius - Ball Lightning'),
+(6, 28099, 4374, 4374, 'Thaddius - Tesla Shock'),
+(7, 28062, 2000, 2000, 'Thaddius - Positive and Negative Charge'),
+(8, 28786, 812, 812, 'Anub\'Rekhan - Locust Swarm'),
+(9, 28622, 657, 843, 'Maexxna - Web Wrap, periodic damage'),
+(10, 29214, 1757, 1757, 'Noth - Revenge of the Plaguebringer, instant damage'),
+(11, 29214, 874, 874, 'Noth - Revenge of the Plaguebringer, periodic damage'),
+(12, 29371, 3500, 4500, 'Heigan - Eruption'),
+(13, 30122, 4000, 4000, 'Heigan - Plague Cloud'),
+(14, 29998, 499, 499, 'Heigan - Decrepit Fever, periodic damage'),
+(15, 29407, 750, 750, 'Heigan - Eye Stalk Mind Flay'),
+(16, 29204, 2549, 2549, 'Loatheb - Inevitable Doom'),
+(17, 26046, 4050, 4950, 'Razuvious - Disrupting Shout mana burn'),
+(18, 57376, 1109, 1109, 'Four Horsemen - Zeliek Holy Bolt'),
+(19, 57374, 1109, 1109, 'Four Horsemen - Blaumeux Shadow Bolt'),
+(20, 28884, 12824, 12824, 'Four Horsemen - Korth\'azz Meteor'),
+(21, 28883, 443, 443, 'Four Horsemen - Zeliek Holy Wrath'),
+(22, 28836, 250, 250, 'Four Horsemen - Mark, 2 stacks'),
+(23, 28836, 1000, 1000, 'Four Horsemen - Mark, 3 stacks'),
+(24, 28836, 3000, 3000, 'Four Horsemen - Mark, 4 stacks'),
+(25, 28836, 1000, 1000, 'Four Horsemen - Mark, per stack from 5 stacks'),
+(26, 28542, 1700, 1700, 'Sapphiron - Life Drain'),
+(27, 28522, 2625, 3375, 'Sapphiron - Icebolt'),
+(28, 28479, 2550, 3450, 'Kel\'Thuzad - Frostbolt'),
+(29, 28457, 1750, 2250, 'Kel\'Thuzad - Dark Blast'),
+(30, 28865, 3960, 4840, 'Four Horsemen - Void Zone Consumption'),
+(31, 60960, 936, 1064, 'Patchwork Golem - War Stomp'),
+(32, 28450, 1838, 2361, 'Unholy Staff - Arcane Explosion'),
+(33, 28153, 278, 322, 'Sewage Slime - Disease Cloud');
@@ -23,6 +23,8 @@ void AddSC_custom_spells_40();
 void AddSC_custom_creatures_40();
 void AddSC_custom_gameobjects_40();
 void AddSC_custom_scripts_40();
+void AddSC_naxxramas_40_commandscript();
+void AddSC_naxxramas_40_tuning();
 
 void AddNaxxramas_Scripts()
 {
@@ -47,4 +49,6 @@ void AddNaxxramas_Scripts()
     AddSC_custom_creatures_40();
     AddSC_custom_gameobjects_40();
     AddSC_custom_scripts_40();
+    AddSC_naxxramas_40_commandscript();
+    AddSC_naxxramas_40_tuning();
 }
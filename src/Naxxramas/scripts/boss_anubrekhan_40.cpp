@@ -18,6 +18,7 @@
 #include "CreatureScript.h"
 #include "ScriptedCreature.h"
 #include "naxxramas.h"
+#include "naxxramas_40_profiler.h"
 
 enum Says
 {
@@ -161,6 +162,13 @@ public:
             }, 10min);
         }
 
+        void UpdateAI(uint32 diff) override
+        {
+            // Scheduler driven, there is no event id to attribute the tick to
+            EncounterProfileScope profile(instance, BOSS_ANUB);
+            BossAI::UpdateAI(diff);
+        }
+
         void MoveInLineOfSight(Unit* who) override
         {
             if (!sayGreet && who->IsPlayer())
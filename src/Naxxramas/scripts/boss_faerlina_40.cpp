@@ -19,6 +19,7 @@
 #include "ScriptedCreature.h"
 #include "SpellInfo.h"
 #include "naxxramas.h"
+#include "naxxramas_40_profiler.h"
 
 enum Yells
 {
@@ -139,6 +140,13 @@ public:
             });
         }
 
+        void UpdateAI(uint32 diff) override
+        {
+            // Scheduler driven, there is no event id to attribute the tick to
+            EncounterProfileScope profile(instance, BOSS_FAERLINA);
+            BossAI::UpdateAI(diff);
+        }
+
         void MoveInLineOfSight(Unit* who) override
         {
             if (!_introDone && who->IsPlayer())
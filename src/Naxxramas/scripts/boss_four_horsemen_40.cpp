@@ -21,6 +21,9 @@
 #include "SpellAuraEffects.h"
 #include "SpellScript.h"
 #include "naxxramas.h"
+#include "naxxramas_40_instance.h"
+#include "naxxramas_40_profiler.h"
+#include "naxxramas_40_tuning.h"
 
 enum Spells
 {
@@ -180,7 +183,8 @@ public:
 
             if (instance->GetBossState(BOSS_HORSEMAN) == DONE)
             {
-                if (!me->GetMap()->GetPlayers().IsEmpty())
+                RaidRoster const& roster = GetNaxxramasRoster(instance);
+                if (!roster.IsEmpty())
                 {
                     if (Creature* spirit = GetClosestCreatureWithEntry(me, NPC_SPIRIT_ZELIEK, 200.0f))
                         spirit->DespawnOrUnsummon();
@@ -190,7 +194,7 @@ public:
                         spirit->DespawnOrUnsummon();
                     if (Creature* spirit = GetClosestCreatureWithEntry(me, NPC_SPIRIT_KORTHAZZ, 200.0f))
                         spirit->DespawnOrUnsummon();
-                    if (Player* player = me->GetMap()->GetPlayers().getFirst()->GetSource())
+                    if (Player* player = roster.GetEntries().front().player)
                         if (GameObject* chest = player->SummonGameObject(GO_HORSEMEN_CHEST_40, 2514.8f, -2944.9f, 245.55f, 5.51f, 0, 0, 0, 0, 0))
                             chest->SetLootRecipient(me);
                 }
@@ -217,6 +221,8 @@ public:
 
         void UpdateAI(uint32 diff) override
         {
+            EncounterProfileScope profile(instance, BOSS_HORSEMAN);
+
             if (!IsInRoom())
                 return;
 
@@ -231,7 +237,9 @@ public:
             if (me->HasUnitState(UNIT_STATE_CASTING))
                 return;
 
-            switch (events.ExecuteEvent())
+            uint32 eventId = events.ExecuteEvent();
+            profile.SetEvent(eventId);
+            switch (eventId)
             {
                 case EVENT_MARK_CAST:
                     me->CastSpell(me, TABLE_SPELL_MARK[horsemanId], false);
@@ -245,12 +253,12 @@ public:
                     Talk(SAY_TAUNT);
                     if (horsemanId == HORSEMAN_ZELIEK)
                     {
-                        int32 bp0 = 1109; // spell not used in vanilla, reduced damage from ~2.5 to ~1.2k
+                        int32 bp0 = sNaxx40Tuning->Roll(TUNING_HORSEMEN_HOLY_BOLT); // spell not used in vanilla, reduced damage from ~2.5 to ~1.2k
                         me->CastCustomSpell(me->GetVictim(), SPELL_ZELIEK_HOLY_BOLT, &bp0, 0, 0, false);
                     }
                     else if (horsemanId == HORSEMAN_BLAUMEUX)
                     {
-                        int32 bp0 = 1109; // spell not used in vanilla, reduced damage from ~2.5 to ~1.2k
+                        int32 bp0 = sNaxx40Tuning->Roll(TUNING_HORSEMEN_SHADOW_BOLT); // spell not used in vanilla, reduced damage from ~2.5 to ~1.2k
                         me->CastCustomSpell(me->GetVictim(), SPELL_BLAUMEUX_SHADOW_BOLT, &bp0, 0, 0, false);
                     }
                     else if (horsemanId == HORSEMAN_MOGRAINE)
@@ -260,7 +268,7 @@ public:
                     }
                     else // HORSEMAN_KORTHAZZ
                     {
-                        int32 bp0 = 12824; // 14.5k to 13.5k
+                        int32 bp0 = sNaxx40Tuning->Roll(TUNING_HORSEMEN_METEOR); // 14.5k to 13.5k
                         me->CastCustomSpell(me->GetVictim(), SPELL_KORTHAZZ_METEOR, &bp0, 0, 0, false);
                     }
                     events.Repeat(15s);
@@ -268,7 +276,7 @@ public:
                 case EVENT_SECONDARY_SPELL:
                     if (horsemanId == HORSEMAN_ZELIEK)
                     {
-                        int32 bp0 = 443;
+                        int32 bp0 = sNaxx40Tuning->Roll(TUNING_HORSEMEN_HOLY_WRATH);
                         CustomSpellValues values;
                         values.AddSpellMod(SPELLVALUE_BASE_POINT0, bp0);
                         values.AddSpellMod(SPELLVALUE_MAX_TARGETS, 50); // 30yd
@@ -335,16 +343,16 @@ class spell_four_horsemen_mark_aura : public AuraScript
                     break;
             }
 
-            if (caster->GetMap()->GetDifficulty() == RAID_DIFFICULTY_10MAN_HEROIC)
+            if (IsNaxx40(caster))
             {
                 switch (GetStackAmount())
                 {
-                    case 1: damage =     0; break;
-                    case 2: damage =   250; break;
-                    case 3: damage =  1000; break;
-                    case 4: damage =  3000; break;
+                    case 1: damage = 0; break;
+                    case 2: damage = sNaxx40Tuning->GetBasePoints(TUNING_HORSEMEN_MARK_2); break;
+                    case 3: damage = sNaxx40Tuning->GetBasePoints(TUNING_HORSEMEN_MARK_3); break;
+                    case 4: damage = sNaxx40Tuning->GetBasePoints(TUNING_HORSEMEN_MARK_4); break;
                     default:
-                        damage = 1000 * GetStackAmount();
+                        damage = sNaxx40Tuning->GetBasePoints(TUNING_HORSEMEN_MARK_PER_STACK) * GetStackAmount();
                         break;
                 }
             }
@@ -21,6 +21,8 @@
 #include "SpellScript.h"
 #include "SpellScriptLoader.h"
 #include "naxxramas.h"
+#include "naxxramas_40_instance.h"
+#include "naxxramas_40_profiler.h"
 
 enum Spells
 {
@@ -92,6 +94,7 @@ public:
             me->ApplySpellImmune(SPELL_INFECTED_WOUND, IMMUNITY_ID, SPELL_INFECTED_WOUND, true);
             events.Reset();
             summons.DespawnAll();
+            DespawnNaxxramasPool(me, NPC_ZOMBIE_CHOW);
             me->SetReactState(REACT_AGGRESSIVE);
         }
 
@@ -133,7 +136,12 @@ public:
             summons.Summon(summon);
         }
 
-        void SummonedCreatureDies(Creature* cr, Unit*) override { summons.Despawn(cr); }
+        void SummonedCreatureDies(Creature* cr, Unit*) override
+        {
+            summons.Despawn(cr);
+            if (cr->GetEntry() == NPC_ZOMBIE_CHOW)
+                ReleaseNaxxramasCreature(cr);
+        }
 
         void KilledUnit(Unit* who) override
         {
@@ -148,6 +156,7 @@ public:
         {
             BossAI::JustDied(killer);
             summons.DespawnAll();
+            DespawnNaxxramasPool(me, NPC_ZOMBIE_CHOW);
         }
 
         bool SelectPlayerInRoom()
@@ -155,11 +164,10 @@ public:
             if (me->IsInCombat())
                 return false;
 
-            Map::PlayerList const& pList = me->GetMap()->GetPlayers();
-            for (auto const& itr : pList)
+            for (RaidRosterEntry const& entry : GetNaxxramasRoster(instance).GetEntries())
             {
-                Player* player = itr.GetSource();
-                if (!player || !player->IsAlive())
+                Player* player = entry.player;
+                if (!entry.alive)
                     continue;
 
                 if (player->GetPositionZ() > 300.0f || me->GetExactDist(player) > 50.0f)
@@ -173,6 +181,8 @@ public:
 
         void UpdateAI(uint32 diff) override
         {
+            EncounterProfileScope profile(instance, BOSS_GLUTH);
+
             if (!UpdateVictimWithGaze() && !SelectPlayerInRoom())
                 return;
 
@@ -180,7 +190,9 @@ public:
             if (me->HasUnitState(UNIT_STATE_CASTING))
                 return;
 
-            switch (events.ExecuteEvent())
+            uint32 eventId = events.ExecuteEvent();
+            profile.SetEvent(eventId);
+            switch (eventId)
             {
                 case EVENT_BERSERK:
                     me->CastSpell(me, SPELL_BERSERK, true);
@@ -236,11 +248,11 @@ public:
                             // In 25 man raid - should spawn from all 3 gates
                             if (me->GetMap()->GetDifficulty() == RAID_DIFFICULTY_10MAN_NORMAL)
                             {
-                                me->SummonCreature(NPC_ZOMBIE_CHOW, zombiePos[0]);
+                                SummonNaxxramasCreature(me, NPC_ZOMBIE_CHOW, zombiePos[0]);
                             }
                             else
                             {
-                                me->SummonCreature(NPC_ZOMBIE_CHOW, zombiePos[urand(0, 2)]);
+                                SummonNaxxramasCreature(me, NPC_ZOMBIE_CHOW, zombiePos[urand(0, 2)]);
                             }
                             (rand == 2 ? rand = 0 : rand++);
                         }
@@ -22,6 +22,10 @@
 #include "SpellScript.h"
 #include "SpellScriptLoader.h"
 #include "naxxramas.h"
+#include "naxxramas_40_difficulty.h"
+#include "naxxramas_40_instance.h"
+#include "naxxramas_40_positions.h"
+#include "naxxramas_40_profiler.h"
 
 enum Yells
 {
@@ -166,13 +170,16 @@ const Position PosSummonDead[5] =
 //const Position PosGroundDeadSide   = {2693.5f, -3334.6f, 267.68f, 4.67f};
 //const Position PosPlatform         = {2640.5f, -3360.6f, 285.26f, 0.0f};
 
-#define POS_Y_GATE  -3360.78f
+#define POS_Y_GATE  GothikGateY
 #define POS_Y_WEST  -3285.0f
 #define POS_Y_EAST  -3434.0f
 #define POS_X_NORTH  2750.49f
 #define POS_X_SOUTH  2633.84f
 #define IN_LIVE_SIDE(who) (who->GetPositionY() < POS_Y_GATE)
 
+static constexpr NaxxRoomBounds GothikLiveSideBounds { POS_X_SOUTH, POS_X_NORTH, POS_Y_EAST, POS_Y_GATE };
+static constexpr NaxxRoomBounds GothikDeadSideBounds { POS_X_SOUTH, POS_X_NORTH, POS_Y_GATE, POS_Y_WEST };
+
 // Predicate function to check that the r   efzr unit is NOT on the same side as the source.
 struct NotOnSameSide
 {
@@ -195,11 +202,14 @@ public:
 
     CreatureAI* GetAI(Creature* pCreature) const override
     {
-        return GetNaxxramasAI<boss_gothik_40AI>(pCreature);
+        return GetNaxxramasDifficultyAI<boss_gothik_40AI>(pCreature);
     }
 
+    template<Difficulty D>
     struct boss_gothik_40AI : public BossAI
     {
+        using Mode = NaxxDifficulty<D>;
+
         explicit boss_gothik_40AI(Creature* c) : BossAI(c, BOSS_GOTHIK), summons(me)
         {}
 
@@ -209,6 +219,27 @@ public:
         bool gateOpened{};
         uint8 waveCount{};
 
+        // Bit i is the roster entry i, refreshed on every update
+        PlayerPositionSnapshot sides;
+        uint64 liveSidePlayers{};
+        uint64 deadSidePlayers{};
+        bool groupSplitted{};
+
+        void RefreshSides()
+        {
+            sides.Refresh(GetNaxxramasRoster(instance));
+            uint64 alive = sides.AliveMask();
+
+            // Wave targets: active players within 200 yards, on either side of the gate
+            uint64 inReach = sides.WithinDistMask(*me, 200.0f) & alive & ~sides.GameMasterMask();
+            uint64 liveSide = sides.BelowYMask(POS_Y_GATE);
+            liveSidePlayers = inReach & liveSide;
+            deadSidePlayers = inReach & ~liveSide;
+
+            // The gate stays closed while living players stand in both halves of the room
+            groupSplitted = (sides.InsideMask(GothikLiveSideBounds) & alive) && (sides.InsideMask(GothikDeadSideBounds) & alive);
+        }
+
         bool IsInRoom()
         {
             if (me->GetPositionX() > 2767 || me->GetPositionX() < 2618 || me->GetPositionY() > -3285 || me->GetPositionY() < -3435)
@@ -263,23 +294,15 @@ public:
             // Else look for a random target on the side the summoned NPC is
             else
             {
-                Map::PlayerList const& pList = me->GetMap()->GetPlayers();
-                std::vector<Player*> tList;
-                for(Map::PlayerList::const_iterator itr = pList.begin(); itr != pList.end(); ++itr)
-                {
-                    if (!me->IsWithinDistInMap(itr->GetSource(), 200.0f, true, false) || !itr->GetSource()->IsAlive() || itr->GetSource()->IsGameMaster())
-                    {
-                        continue;
-                    }
-                    if (IN_LIVE_SIDE(itr->GetSource()) != IN_LIVE_SIDE(summon))
-                    {
-                        continue;
-                    }
-                    tList.push_back(itr->GetSource());
-                }
-                if (!tList.empty())
+                // The side masks are up to one update old, check the picked player again before attacking
+                std::vector<RaidRosterEntry> const& roster = GetNaxxramasRoster(instance).GetEntries();
+                uint8 index = PlayerPositionSnapshot::SelectRandomIndex(IN_LIVE_SIDE(summon) ? liveSidePlayers : deadSidePlayers);
+                if (index >= roster.size() || !RaidRoster::IsActive(roster[index]))
+                    return;
+
+                Player* target = roster[index].player;
+                if (IN_LIVE_SIDE(target) == IN_LIVE_SIDE(summon) && me->IsWithinDistInMap(target, 200.0f, true, false))
                 {
-                    Player* target = tList[urand(0, tList.size() - 1)];
                     summon->AI()->AttackStart(target);
                     summon->SetInCombatWithZone();
                     summon->SetReactState(REACT_AGGRESSIVE);
@@ -316,14 +339,14 @@ public:
                 case NPC_LIVING_TRAINEE:
                     me->SummonCreature(NPC_LIVING_TRAINEE, PosSummonLiving[0].GetPositionX(), PosSummonLiving[0].GetPositionY(), PosSummonLiving[0].GetPositionZ(), PosSummonLiving[0].GetOrientation());
                     me->SummonCreature(NPC_LIVING_TRAINEE, PosSummonLiving[1].GetPositionX(), PosSummonLiving[1].GetPositionY(), PosSummonLiving[1].GetPositionZ(), PosSummonLiving[1].GetOrientation());
-                    if (Is25ManRaid())
+                    if (Mode::Is25Man(me))
                     {
                         me->SummonCreature(NPC_LIVING_TRAINEE, PosSummonLiving[2].GetPositionX(), PosSummonLiving[2].GetPositionY(), PosSummonLiving[2].GetPositionZ(), PosSummonLiving[2].GetOrientation());
                     }
                     break;
                 case NPC_LIVING_KNIGHT:
                     me->SummonCreature(NPC_LIVING_KNIGHT, PosSummonLiving[3].GetPositionX(), PosSummonLiving[3].GetPositionY(), PosSummonLiving[3].GetPositionZ(), PosSummonLiving[3].GetOrientation());
-                    if (Is25ManRaid())
+                    if (Mode::Is25Man(me))
                     {
                         me->SummonCreature(NPC_LIVING_KNIGHT, PosSummonLiving[5].GetPositionX(), PosSummonLiving[5].GetPositionY(), PosSummonLiving[5].GetPositionZ(), PosSummonLiving[5].GetOrientation());
                     }
@@ -336,36 +359,7 @@ public:
 
         bool CheckGroupSplitted()
         {
-            Map::PlayerList const& PlayerList = me->GetMap()->GetPlayers();
-            if (!PlayerList.IsEmpty())
-            {
-                bool checklife = false;
-                bool checkdead = false;
-                for (auto const& i : PlayerList)
-                {
-                    Player* player = i.GetSource();
-                    if (player->IsAlive() &&
-                        player->GetPositionX() <= POS_X_NORTH &&
-                        player->GetPositionX() >= POS_X_SOUTH &&
-                        player->GetPositionY() <= POS_Y_GATE &&
-                        player->GetPositionY() >= POS_Y_EAST)
-                        {
-                            checklife = true;
-                        }
-                    else if (player->IsAlive() &&
-                             player->GetPositionX() <= POS_X_NORTH &&
-                             player->GetPositionX() >= POS_X_SOUTH &&
-                             player->GetPositionY() >= POS_Y_GATE &&
-                             player->GetPositionY() <= POS_Y_WEST)
-                             {
-                                 checkdead = true;
-                             }
-
-                    if (checklife && checkdead)
-                        return true;
-                }
-            }
-            return false;
+            return groupSplitted;
         }
 
         void DamageTaken(Unit*, uint32& damage, DamageEffectType, SpellSchoolMask) override
@@ -378,17 +372,23 @@ public:
 
         void UpdateAI(uint32 diff) override
         {
+            EncounterProfileScope profile(instance, BOSS_GOTHIK);
+
             if (!IsInRoom())
                 return;
 
             if (!UpdateVictim())
                 return;
 
+            RefreshSides();
+
             events.Update(diff);
             if (me->HasUnitState(UNIT_STATE_CASTING))
                 return;
 
-            switch (events.ExecuteEvent())
+            uint32 eventId = events.ExecuteEvent();
+            profile.SetEvent(eventId);
+            switch (eventId)
             {
                 case EVENT_INTRO_2:
                     Talk(SAY_INTRO_2);
@@ -400,7 +400,7 @@ public:
                     Talk(SAY_INTRO_4);
                     break;
                 case EVENT_SHADOW_BOLT:
-                    me->CastSpell(me->GetVictim(), RAID_MODE(SPELL_SHADOW_BOLT_10, SPELL_SHADOW_BOLT_25, SPELL_SHADOW_BOLT_10, SPELL_SHADOW_BOLT_25), false);
+                    me->CastSpell(me->GetVictim(), Mode::RaidMode(me, SPELL_SHADOW_BOLT_10, SPELL_SHADOW_BOLT_25, SPELL_SHADOW_BOLT_10, SPELL_SHADOW_BOLT_25), false);
                     events.Repeat(1s);
                     break;
                 case EVENT_HARVEST_SOUL:
@@ -650,6 +650,15 @@ public:
 
         Creature* SelectRandomSkullPile()
         {
+            if (NaxxramasInstanceScript* instance = GetNaxxramasInstance(me->GetInstanceScript()))
+            {
+                std::vector<ObjectGuid> const& deadSide = instance->GetGothikTriggers(false);
+                if (!deadSide.empty())
+                    return ObjectAccessor::GetCreature(*me, Acore::Containers::SelectRandomContainerElement(deadSide));
+            }
+
+            // Not collected by the instance, search them as before
+            CountEncounterGridSearch(me->GetInstanceScript(), BOSS_GOTHIK);
             std::list<Creature*> triggers;
             me->GetCreatureListWithEntryInGrid(triggers, NPC_TRIGGER, 150.0f);
             // Remove triggers that are on live side or soul triggers on the platform
@@ -22,7 +22,13 @@
 #include "SpellAuras.h"
 #include "SpellScript.h"
 #include "SpellScriptLoader.h"
+#include "VanillaNaxxramas.h"
 #include "naxxramas.h"
+#include "naxxramas_40_instance.h"
+#include "naxxramas_40_profiler.h"
+#include "naxxramas_40_targeting.h"
+#include "naxxramas_40_tuning.h"
+#include <cmath>
 
 enum Spells
 {
@@ -141,6 +147,8 @@ public:
 
         void UpdateAI(uint32 diff) override
         {
+            EncounterProfileScope profile(instance, BOSS_GROBBULUS);
+
             dropSludgeTimer += diff;
             if (!me->IsInCombat() && dropSludgeTimer >= 5000)
             {
@@ -158,7 +166,9 @@ public:
             if (me->HasUnitState(UNIT_STATE_CASTING))
                 return;
 
-            switch (events.ExecuteEvent())
+            uint32 eventId = events.ExecuteEvent();
+            profile.SetEvent(eventId);
+            switch (eventId)
             {
                 case EVENT_POISON_CLOUD:
                     me->CastSpell(me, SPELL_POISON_CLOUD, true);
@@ -171,13 +181,14 @@ public:
                     Talk(EMOTE_SLIME);
                     if (Unit* target = me->GetVictim())
                     {
-                        int32 bp0 = urand(3200, 4800);
+                        int32 bp0 = sNaxx40Tuning->Roll(TUNING_GROBBULUS_SLIME_SPRAY);
                         me->CastCustomSpell(target, SPELL_SLIME_SPRAY_10, &bp0, nullptr, nullptr, false);
                     }
                     events.Repeat(20s);
                     break;
                 case EVENT_MUTATING_INJECTION:
-                    if (Unit* target = SelectTarget(SelectTargetMethod::Random, 1, 100.0f, true, true, -SPELL_MUTATING_INJECTION))
+                    if (Unit* target = SelectRandomThreatTarget(me->GetThreatMgr(),
+                        NaxxTarget::AllOf(NaxxTarget::IsPlayer(), NaxxTarget::InRange{ me, 100.0f }, NaxxTarget::NotAura{ SPELL_MUTATING_INJECTION }), 1))
                     {
                         me->CastSpell(target, SPELL_MUTATING_INJECTION, false);
                     }
@@ -189,6 +200,19 @@ public:
     };
 };
 
+static constexpr float PoisonCloudStartRadius = 2.0f;
+static constexpr float PoisonCloudGrowthPerMs  = 0.00025f; // 15yd in 60 seconds
+
+// Radius of a poison cloud after age milliseconds, rounded down to a multiple of step
+static float GetPoisonCloudRadius(uint32 age, float step)
+{
+    float growth = PoisonCloudGrowthPerMs * age;
+    if (step > 0.0f)
+        growth = std::floor(growth / step) * step;
+
+    return PoisonCloudStartRadius + growth;
+}
+
 class boss_grobbulus_poison_cloud_40 : public CreatureScript
 {
 public:
@@ -205,12 +229,14 @@ public:
 
         uint32 sizeTimer{};
         uint32 auraVisualTimer{};
+        float radius{};
 
         void Reset() override
         {
             sizeTimer = 0;
             auraVisualTimer = 1;
-            me->SetFloatValue(UNIT_FIELD_COMBATREACH, 2.0f);
+            radius = PoisonCloudStartRadius;
+            me->SetFloatValue(UNIT_FIELD_COMBATREACH, radius);
             me->SetFaction(FACTION_BOOTY_BAY);
         }
 
@@ -231,8 +257,14 @@ public:
                     auraVisualTimer = 0;
                 }
             }
-            sizeTimer += diff; // increase size to 15yd in 60 seconds, 0.00025 is the growth of size in 1ms
-            me->SetFloatValue(UNIT_FIELD_COMBATREACH, 2.0f + (0.00025f * sizeTimer));
+            // The combat reach is the radius of the damage aura, only sent when it grows by a whole step
+            sizeTimer += diff;
+            float newRadius = GetPoisonCloudRadius(sizeTimer, sVanillaNaxxramas->poisonCloudGrowthStep);
+            if (newRadius != radius)
+            {
+                radius = newRadius;
+                me->SetFloatValue(UNIT_FIELD_COMBATREACH, radius);
+            }
         }
     };
 };
@@ -282,9 +314,9 @@ class spell_grobbulus_mutating_injection_aura : public AuraScript
             case AURA_REMOVE_BY_EXPIRE:
                 if (auto caster = GetCaster())
                 {
-                    if (caster->GetMap()->GetDifficulty() == RAID_DIFFICULTY_10MAN_HEROIC)
+                    if (IsNaxx40(caster))
                     {
-                        int32 modifiedMutatingExplosionDamage = 2379;
+                        int32 modifiedMutatingExplosionDamage = sNaxx40Tuning->Roll(TUNING_GROBBULUS_MUTATING_EXPLOSION);
                         caster->CastCustomSpell(GetTarget(), SPELL_MUTATING_EXPLOSION, &modifiedMutatingExplosionDamage, 0, 0, true);
                     }
                     else
@@ -24,6 +24,11 @@
 #include "SpellScript.h"
 #include "SpellScriptLoader.h"
 #include "naxxramas.h"
+#include "naxxramas_40_instance.h"
+#include "naxxramas_40_positions.h"
+#include "naxxramas_40_profiler.h"
+#include "naxxramas_40_targeting.h"
+#include "naxxramas_40_tuning.h"
 
 enum Says
 {
@@ -89,6 +94,9 @@ const Position EyeStalkPositions[20] =
     { 2813.34f, -3780.97f, 275.08f, 1.84f },
 };
 
+static constexpr NaxxRoomBounds HeiganRoomBounds { HeiganRoomMinX, HeiganRoomMaxX, HeiganRoomMinY, HeiganRoomMaxY };
+static constexpr float HeiganTunnelY = -3735.0f;
+
 class boss_heigan_40 : public CreatureScript
 {
 public:
@@ -101,25 +109,23 @@ public:
 
     struct boss_heigan_40AI : public BossAI
     {
-        explicit boss_heigan_40AI(Creature* c) : BossAI(c, BOSS_HEIGAN)
+        explicit boss_heigan_40AI(Creature* c) : BossAI(c, BOSS_HEIGAN), portedPlayersThisPhase(GetNaxxramasRoster(instance))
         {}
 
         EventMap events;
         uint8 currentPhase{};
-        uint8 currentSection{};
-        bool moveRight{};
+        uint8 eruptStep{};
 
-        GuidList portedPlayersThisPhase;
+        RaidMemberSet portedPlayersThisPhase;
 
         void Reset() override
         {
             BossAI::Reset();
             events.Reset();
             currentPhase = 0;
-            currentSection = 3;
-            portedPlayersThisPhase.clear();
+            eruptStep = 0;
+            portedPlayersThisPhase.Clear();
             KillPlayersInTheTunnel();
-            moveRight = true;
         }
 
         void KilledUnit(Unit* who) override
@@ -147,7 +153,7 @@ public:
 
         void StartFightPhase(uint8 phase)
         {
-            currentSection = 3;
+            eruptStep = 0;
             currentPhase = phase;
             events.Reset();
             if (phase == PHASE_SLOW_DANCE)
@@ -160,7 +166,7 @@ public:
                 events.ScheduleEvent(EVENT_ERUPT_SECTION, 15s);
                 events.ScheduleEvent(EVENT_SWITCH_PHASE, 90s);
                 events.ScheduleEvent(EVENT_TELEPORT_PLAYER, 40s);
-                portedPlayersThisPhase.clear();
+                portedPlayersThisPhase.Clear();
             }
             else // if (phase == PHASE_FAST_DANCE)
             {
@@ -180,7 +186,7 @@ public:
 
         bool IsInRoom(Unit* who)
         {
-            if (who->GetPositionX() > 2826 || who->GetPositionX() < 2723 || who->GetPositionY() > -3641 || who->GetPositionY() < -3736)
+            if (who->GetPositionX() > HeiganRoomMaxX || who->GetPositionX() < HeiganRoomMinX || who->GetPositionY() > HeiganRoomMaxY || who->GetPositionY() < HeiganRoomMinY)
             {
                 if (who->GetGUID() == me->GetGUID())
                     EnterEvadeMode();
@@ -193,44 +199,31 @@ public:
         void KillPlayersInTheTunnel()
         {
             // hackfix: kill everyone in the tunnel
-            Map::PlayerList const& PlayerList = me->GetMap()->GetPlayers();
-            for (auto const& itr : PlayerList)
-                if (Player* player = itr.GetSource())
-                    if (player->IsAlive() && !player->IsGameMaster())
-                        if (player->GetPositionY() <= -3735.0f)
-                            player->KillSelf();
+            PlayerPositionSnapshot snapshot(GetNaxxramasRoster(instance));
+            snapshot.ForEach(snapshot.BelowYMask(HeiganTunnelY) & snapshot.AliveMask() & ~snapshot.GameMasterMask(), [](Player* player)
+            {
+                player->KillSelf();
+            });
         }
 
         void DoEventTeleportPlayer()
         {
-            std::list<Unit*> candidates;
-            SelectTargetList(candidates, 3, SelectTargetMethod::Random, 0, [&](Unit* target)
+            // Never the tank, nor players who have already been teleported this phase
+            auto entries = SelectRandomRoster<3>(GetNaxxramasRoster(instance), 3, [this](RaidRosterEntry const& entry)
             {
-                if (!target->IsPlayer()) // never target nonplayers (pets, guardians, etc.)
-                    return false;
-                if (!target->IsAlive())
-                    return false;
-                if (me->GetVictim() == target) // never target tank
-                    return false;
-                // skip players who already have been teleported this phase
-                if (std::find(portedPlayersThisPhase.begin(), portedPlayersThisPhase.end(), target->GetGUID()) != portedPlayersThisPhase.end())
-                    return false;
-                return true;
+                return RaidRoster::IsActive(entry) && entry.player != me->GetVictim() && !portedPlayersThisPhase.Contains(entry)
+                    && RaidRoster::GetRoom(*entry.player) == BOSS_HEIGAN;
             });
 
-            if (candidates.empty())
-                return;
+            FixedVector<Player*, 3> targets;
+            for (RaidRosterEntry const* entry : entries)
+            {
+                portedPlayersThisPhase.Insert(*entry);
+                targets.push_back(entry->player);
+            }
 
-            for (int i = 0; i < 3 ; i++)
+            for (Player* target : targets)
             {
-                if (candidates.empty())
-                    break;
-                auto itr = candidates.begin();
-                if (candidates.size() > 1)
-                    std::advance(itr, urand(0, candidates.size() - 1));
-                Unit *target = *itr;
-                candidates.erase(itr);
-                portedPlayersThisPhase.push_back(target->GetGUID());
                 DoModifyThreatByPercent(target, -99); // prevent heigan chasing and resetting
                 target->CastSpell(target, SPELL_TELEPORT_PLAYERS, true);
             }
@@ -238,6 +231,8 @@ public:
 
         void UpdateAI(uint32 diff) override
         {
+            EncounterProfileScope profile(instance, BOSS_HEIGAN);
+
             if (!IsInRoom(me))
                 return;
 
@@ -252,7 +247,9 @@ public:
 
             events.Update(diff);
 
-            switch (events.ExecuteEvent())
+            uint32 eventId = events.ExecuteEvent();
+            profile.SetEvent(eventId);
+            switch (eventId)
             {
                 case EVENT_DISRUPTION:
                     me->CastCustomSpell(SPELL_DISRUPTION, SPELLVALUE_RADIUS_MOD, 2500, me, false); // 25yd
@@ -260,7 +257,7 @@ public:
                     break;
                 case EVENT_DECEPIT_FEVER:
                 {
-                    int32 bp1 = 499;
+                    int32 bp1 = sNaxx40Tuning->Roll(TUNING_HEIGAN_DECREPIT_FEVER);
                     me->CastCustomSpell(me, SPELL_DECREPIT_FEVER_10, 0, &bp1, 0, false, nullptr, nullptr, ObjectGuid::Empty);
                     events.Repeat(22s, 25s);
                     break;
@@ -281,13 +278,8 @@ public:
                     break;
                 case EVENT_ERUPT_SECTION:
                 {
-                    instance->SetData(DATA_HEIGAN_ERUPTION, currentSection);
-                    if (currentSection == 3)
-                        moveRight = false;
-                    else if (currentSection == 0)
-                        moveRight = true;
-
-                    moveRight ? currentSection++ : currentSection--;
+                    instance->SetData(DATA_HEIGAN_ERUPTION, HeiganEruptSchedule[eruptStep]);
+                    eruptStep = (eruptStep + 1) % HeiganEruptSchedule.size();
 
                     if (currentPhase == PHASE_SLOW_DANCE)
                         Talk(SAY_TAUNT);
@@ -298,15 +290,12 @@ public:
                 break;
                 case EVENT_SAFETY_DANCE:
                 {
-                    Map::PlayerList const& pList = me->GetMap()->GetPlayers();
-                    for (auto const& itr : pList)
+                    PlayerPositionSnapshot snapshot(GetNaxxramasRoster(instance));
+                    if (snapshot.InsideMask(HeiganRoomBounds) & snapshot.DeadMask())
                     {
-                        if (IsInRoom(itr.GetSource()) && !itr.GetSource()->IsAlive())
-                        {
-                            instance->SetData(DATA_DANCE_FAIL, 0);
-                            instance->StorePersistentData(PERSISTENT_DATA_IMMORTAL_FAIL, 1);
-                            return;
-                        }
+                        instance->SetData(DATA_DANCE_FAIL, 0);
+                        instance->StorePersistentData(PERSISTENT_DATA_IMMORTAL_FAIL, 1);
+                        return;
                     }
                     events.Repeat(5s);
                     return;
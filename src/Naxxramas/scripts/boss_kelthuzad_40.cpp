@@ -21,6 +21,10 @@
 #include "ScriptedCreature.h"
 #include "SpellScript.h"
 #include "naxxramas.h"
+#include "naxxramas_40_difficulty.h"
+#include "naxxramas_40_profiler.h"
+#include "naxxramas_40_spawn_scheduler.h"
+#include "naxxramas_40_targeting.h"
 
 enum Yells
 {
@@ -139,35 +143,40 @@ public:
 
     CreatureAI* GetAI(Creature* pCreature) const override
     {
-        return GetNaxxramasAI<boss_kelthuzad_40AI>(pCreature);
+        return GetNaxxramasDifficultyAI<boss_kelthuzad_40AI>(pCreature);
     }
 
+    template<Difficulty D>
     struct boss_kelthuzad_40AI : public BossAI
     {
+        using Mode = NaxxDifficulty<D>;
+
         explicit boss_kelthuzad_40AI(Creature* c) : BossAI(c, BOSS_KELTHUZAD), summons(me)
         {}
 
         EventMap events;
         SummonList summons;
+        SpawnScheduler spawner;
 
         float NormalizeOrientation(float o)
         {
             return std::fmod(o, 2.0f * static_cast<float>(M_PI)); // Only positive values will be passed
         }
 
+        // Around 80 creatures, queued and summoned over the next updates to avoid a spike
         void SpawnHelpers()
         {
             // spawn at gate
-            me->SummonCreature(NPC_UNSTOPPABLE_ABOMINATION, 3656.19f, -5093.78f, 143.33f, 6.08, TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000);// abo center
-            me->SummonCreature(NPC_UNSTOPPABLE_ABOMINATION, 3657.94f, -5087.68f, 143.60f, 6.08, TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000);// abo left
-            me->SummonCreature(NPC_UNSTOPPABLE_ABOMINATION, 3655.48f, -5100.05f, 143.53f, 6.08, TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000);// abo right
-            me->SummonCreature(NPC_SOUL_WEAVER, 3651.73f, -5092.62f, 143.38f, 6.05, TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000); // soul behind
-            me->SummonCreature(NPC_SOLDIER_OF_THE_FROZEN_WASTES, 3660.17f, -5092.45f, 143.37f, 6.07, TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000); // ske front left
-            me->SummonCreature(NPC_SOLDIER_OF_THE_FROZEN_WASTES, 3659.39f, -5096.21f, 143.29f, 6.07, TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000); // ske front right
-            me->SummonCreature(NPC_SOLDIER_OF_THE_FROZEN_WASTES, 3659.29f, -5090.19f, 143.48f, 6.07, TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000); // ske left left
-            me->SummonCreature(NPC_SOLDIER_OF_THE_FROZEN_WASTES, 3657.43f, -5098.03f, 143.41f, 6.07, TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000); // ske right right
-            me->SummonCreature(NPC_SOLDIER_OF_THE_FROZEN_WASTES, 3654.36f, -5090.51f, 143.48f, 6.09, TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000); // ske behind left
-            me->SummonCreature(NPC_SOLDIER_OF_THE_FROZEN_WASTES, 3653.35f, -5095.91f, 143.41f, 6.09, TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000); // ske right right
+            spawner.Queue(NPC_UNSTOPPABLE_ABOMINATION, Position(3656.19f, -5093.78f, 143.33f, 6.08), TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000);// abo center
+            spawner.Queue(NPC_UNSTOPPABLE_ABOMINATION, Position(3657.94f, -5087.68f, 143.60f, 6.08), TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000);// abo left
+            spawner.Queue(NPC_UNSTOPPABLE_ABOMINATION, Position(3655.48f, -5100.05f, 143.53f, 6.08), TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000);// abo right
+            spawner.Queue(NPC_SOUL_WEAVER, Position(3651.73f, -5092.62f, 143.38f, 6.05), TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000); // soul behind
+            spawner.Queue(NPC_SOLDIER_OF_THE_FROZEN_WASTES, Position(3660.17f, -5092.45f, 143.37f, 6.07), TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000); // ske front left
+            spawner.Queue(NPC_SOLDIER_OF_THE_FROZEN_WASTES, Position(3659.39f, -5096.21f, 143.29f, 6.07), TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000); // ske front right
+            spawner.Queue(NPC_SOLDIER_OF_THE_FROZEN_WASTES, Position(3659.29f, -5090.19f, 143.48f, 6.07), TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000); // ske left left
+            spawner.Queue(NPC_SOLDIER_OF_THE_FROZEN_WASTES, Position(3657.43f, -5098.03f, 143.41f, 6.07), TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000); // ske right right
+            spawner.Queue(NPC_SOLDIER_OF_THE_FROZEN_WASTES, Position(3654.36f, -5090.51f, 143.48f, 6.09), TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000); // ske behind left
+            spawner.Queue(NPC_SOLDIER_OF_THE_FROZEN_WASTES, Position(3653.35f, -5095.91f, 143.41f, 6.09), TEMPSUMMON_CORPSE_TIMED_DESPAWN, 2000); // ske right right
 
             // 6 rooms, 8 soldiers, 3 abominations and 1 weaver in each room | middle positions in table starts from 6
             for (uint8 i = 6; i < 12; ++i)
@@ -175,7 +184,7 @@ public:
                 for (uint8 j = 0; j < 8; ++j)
                 {
                     float angle = M_PI * 2 / 8 * j;
-                    me->SummonCreature(NPC_SOLDIER_OF_THE_FROZEN_WASTES, SummonGroups[i].GetPositionX() + 6 * cos(angle), SummonGroups[i].GetPositionY() + 6 * std::sin(angle), SummonGroups[i].GetPositionZ(), SummonGroups[i].GetOrientation(), TEMPSUMMON_CORPSE_TIMED_DESPAWN, 20000);
+                    spawner.Queue(NPC_SOLDIER_OF_THE_FROZEN_WASTES, Position(SummonGroups[i].GetPositionX() + 6 * cos(angle), SummonGroups[i].GetPositionY() + 6 * std::sin(angle), SummonGroups[i].GetPositionZ(), SummonGroups[i].GetOrientation()), TEMPSUMMON_CORPSE_TIMED_DESPAWN, 20000);
                 }
             }
             for (uint8 i = 6; i < 12; ++i)
@@ -184,7 +193,7 @@ public:
                 {
                     float dist = j == 2 ? 0.0f : 8.0f; // second in middle
                     float angle = SummonGroups[i].GetOrientation() + M_PI * 2 / 4 * j;
-                    me->SummonCreature(NPC_UNSTOPPABLE_ABOMINATION, SummonGroups[i].GetPositionX() + dist * cos(angle), SummonGroups[i].GetPositionY() + dist * std::sin(angle), SummonGroups[i].GetPositionZ(), SummonGroups[i].GetOrientation(), TEMPSUMMON_CORPSE_TIMED_DESPAWN, 20000);
+                    spawner.Queue(NPC_UNSTOPPABLE_ABOMINATION, Position(SummonGroups[i].GetPositionX() + dist * cos(angle), SummonGroups[i].GetPositionY() + dist * std::sin(angle), SummonGroups[i].GetPositionZ(), SummonGroups[i].GetOrientation()), TEMPSUMMON_CORPSE_TIMED_DESPAWN, 20000);
                 }
             }
             for (uint8 i = 6; i < 12; ++i)
@@ -192,7 +201,7 @@ public:
                 for (uint8 j = 0; j < 1; ++j)
                 {
                     float angle = SummonGroups[i].GetOrientation() + M_PI;
-                    me->SummonCreature(NPC_SOUL_WEAVER, SummonGroups[i].GetPositionX() + 6 * cos(angle), SummonGroups[i].GetPositionY() + 6 * std::sin(angle), SummonGroups[i].GetPositionZ() + 0.5f, SummonGroups[i].GetOrientation(), TEMPSUMMON_CORPSE_TIMED_DESPAWN, 20000);
+                    spawner.Queue(NPC_SOUL_WEAVER, Position(SummonGroups[i].GetPositionX() + 6 * cos(angle), SummonGroups[i].GetPositionY() + 6 * std::sin(angle), SummonGroups[i].GetPositionZ() + 0.5f, SummonGroups[i].GetOrientation()), TEMPSUMMON_CORPSE_TIMED_DESPAWN, 20000);
                 }
             }
         }
@@ -216,6 +225,7 @@ public:
         {
             BossAI::Reset();
             events.Reset();
+            spawner.Clear();
             summons.DespawnAll();
             me->RemoveUnitFlag(UNIT_FLAG_NON_ATTACKABLE | UNIT_FLAG_DISABLE_MOVE);
             me->SetReactState(REACT_AGGRESSIVE);
@@ -256,6 +266,7 @@ public:
         void JustDied(Unit*  killer) override
         {
             BossAI::JustDied(killer);
+            spawner.Clear();
             summons.DoAction(ACTION_GUARDIANS_OFF);
             if (Creature* guardian = summons.GetCreatureWithEntry(NPC_GUARDIAN_OF_ICECROWN))
             {
@@ -308,17 +319,23 @@ public:
 
         void UpdateAI(uint32 diff) override
         {
+            EncounterProfileScope profile(instance, BOSS_KELTHUZAD);
+
             if (!UpdateVictim())
                 return;
 
             events.Update(diff);
+            spawner.Update(me);
+
             if (!me->HasAura(SPELL_KELTHUZAD_CHANNEL))
             {
                 if (me->HasUnitState(UNIT_STATE_CASTING))
                     return;
             }
 
-            switch (events.ExecuteEvent())
+            uint32 eventId = events.ExecuteEvent();
+            profile.SetEvent(eventId);
+            switch (eventId)
             {
                 case EVENT_FLOOR_CHANGE:
                     if (GameObject* go = instance->GetGameObject(DATA_KELTHUZAD_FLOOR))
@@ -358,7 +375,7 @@ public:
                     events.ScheduleEvent(EVENT_PHASE_3, 1s);
                     events.ScheduleEvent(EVENT_SHADOW_FISSURE, 25s);
                     events.ScheduleEvent(EVENT_FROST_BLAST, 45s);
-                    if (Is25ManRaid())
+                    if (Mode::Is25Man(me))
                     {
                         events.ScheduleEvent(EVENT_CHAINS, 90s);
                     }
@@ -367,11 +384,11 @@ public:
                     me->CastSpell(me, SPELL_BERSERK, true);
                     break;
                 case EVENT_FROST_BOLT_SINGLE:
-                    me->CastSpell(me->GetVictim(), RAID_MODE(SPELL_FROST_BOLT_SINGLE_10, SPELL_FROST_BOLT_SINGLE_25, SPELL_FROST_BOLT_SINGLE_10, SPELL_FROST_BOLT_SINGLE_25), false);
+                    me->CastSpell(me->GetVictim(), Mode::RaidMode(me, SPELL_FROST_BOLT_SINGLE_10, SPELL_FROST_BOLT_SINGLE_25, SPELL_FROST_BOLT_SINGLE_10, SPELL_FROST_BOLT_SINGLE_25), false);
                     events.Repeat(2s, 10s);
                     break;
                 case EVENT_FROST_BOLT_MULTI:
-                    me->CastSpell(me, RAID_MODE(SPELL_FROST_BOLT_MULTI_10, SPELL_FROST_BOLT_MULTI_25, SPELL_FROST_BOLT_MULTI_10, SPELL_FROST_BOLT_MULTI_25), false);
+                    me->CastSpell(me, Mode::RaidMode(me, SPELL_FROST_BOLT_MULTI_10, SPELL_FROST_BOLT_MULTI_25, SPELL_FROST_BOLT_MULTI_10, SPELL_FROST_BOLT_MULTI_25), false);
                     events.Repeat(15s, 30s);
                     break;
                 case EVENT_SHADOW_FISSURE:
@@ -382,7 +399,7 @@ public:
                     events.Repeat(25s);
                     break;
                 case EVENT_FROST_BLAST:
-                    if (Unit* target = SelectTarget(SelectTargetMethod::Random, RAID_MODE(1, 0, 0, 0), 0, true))
+                    if (Unit* target = SelectRandomThreatTarget(me->GetThreatMgr(), NaxxTarget::IsPlayer(), Mode::RaidMode(me, 1, 0, 0, 0)))
                     {
                         me->CastSpell(target, SPELL_FROST_BLAST, false);
                     }
@@ -390,39 +407,23 @@ public:
                     events.Repeat(45s);
                     break;
                 case EVENT_CHAINS:
-                    for (uint8 i = 0; i < 3; ++i)
+                    // Three different players, never the current victim
+                    for (Unit* target : SelectRandomThreat<3>(me->GetThreatMgr(), 3,
+                        NaxxTarget::AllOf(NaxxTarget::IsPlayer(), NaxxTarget::InRange{ me, 200.0f }, NaxxTarget::NotAura{ SPELL_CHAINS_OF_KELTHUZAD }), 1))
                     {
-                        if (Unit* target = SelectTarget(SelectTargetMethod::Random, 1, 200, true, true, -SPELL_CHAINS_OF_KELTHUZAD))
-                        {
-                            me->CastSpell(target, SPELL_CHAINS_OF_KELTHUZAD, true);
-                        }
+                        me->CastSpell(target, SPELL_CHAINS_OF_KELTHUZAD, true);
                     }
                     Talk(SAY_CHAIN);
                     events.Repeat(90s);
                     break;
                 case EVENT_DETONATE_MANA:
+                    if (Unit* target = SelectRandomThreatTarget(me->GetThreatMgr(), NaxxTarget::AllOf(NaxxTarget::IsPlayer(), NaxxTarget::HasPower{ POWER_MANA })))
                     {
-                        std::vector<Unit*> unitList;
-                        ThreatContainer::StorageType const& threatList = me->GetThreatMgr().GetThreatList();
-                        for (auto itr : threatList)
-                        {
-                            if (itr->getTarget()->IsPlayer()
-                                    && itr->getTarget()->getPowerType() == POWER_MANA
-                                    && itr->getTarget()->GetPower(POWER_MANA))
-                                    {
-                                        unitList.push_back(itr->getTarget());
-                                    }
-                        }
-                        if (!unitList.empty())
-                        {
-                            auto itr = unitList.begin();
-                            advance(itr, urand(0, unitList.size() - 1));
-                            me->CastSpell(*itr, SPELL_DETONATE_MANA, false);
-                            Talk(SAY_SPECIAL);
-                        }
-                        events.Repeat(30s);
-                        break;
+                        me->CastSpell(target, SPELL_DETONATE_MANA, false);
+                        Talk(SAY_SPECIAL);
                     }
+                    events.Repeat(30s);
+                    break;
                 case EVENT_PHASE_3:
                     if (me->HealthBelowPct(45))
                     {
@@ -450,7 +451,7 @@ public:
                     if (Creature* cr = instance->GetCreature(DATA_LICH_KING_BOSS))
                         cr->AI()->Talk(SAY_ANSWER_REQUEST);
 
-                    for (uint8 i = 0 ; i < RAID_MODE(2, 4, 4, 4); ++i)
+                    for (uint8 i = 0 ; i < Mode::RaidMode(me, 2, 4, 4, 4); ++i)
                         events.ScheduleEvent(EVENT_SUMMON_GUARDIAN_OF_ICECROWN, Milliseconds(10000 + (i * 5000)));
 
                     break;
@@ -633,19 +634,10 @@ class spell_kelthuzad_frost_blast : public SpellScript
         if (!caster || !caster->ToCreature())
             return;
 
-        std::list<WorldObject*> tmplist;
-        for (auto& target : targets)
-        {
-            if (!target->ToUnit()->HasAura(SPELL_FROST_BLAST))
-            {
-                tmplist.push_back(target);
-            }
-        }
-        targets.clear();
-        for (auto& itr : tmplist)
+        targets.remove_if([](WorldObject* target)
         {
-            targets.push_back(itr);
-        }
+            return target->ToUnit()->HasAura(SPELL_FROST_BLAST);
+        });
     }
 
     void Register() override
@@ -18,6 +18,8 @@
 #include "CreatureScript.h"
 #include "ScriptedCreature.h"
 #include "naxxramas.h"
+#include "naxxramas_40_profiler.h"
+#include "naxxramas_40_tuning.h"
 
 enum Spells
 {
@@ -113,6 +115,8 @@ public:
 
         void UpdateAI(uint32 diff) override
         {
+            EncounterProfileScope profile(instance, BOSS_LOATHEB);
+
             if (!UpdateVictim() || !IsInRoom())
                 return;
 
@@ -120,7 +124,9 @@ public:
             if (me->HasUnitState(UNIT_STATE_CASTING))
                 return;
 
-            switch (events.ExecuteEvent())
+            uint32 eventId = events.ExecuteEvent();
+            profile.SetEvent(eventId);
+            switch (eventId)
             {
                 case EVENT_SUMMON_SPORE:
                     me->CastSpell(me, SPELL_SUMMON_SPORE, true);
@@ -146,7 +152,7 @@ public:
                     break;
                 case EVENT_INEVITABLE_DOOM:
                 {
-                    int32 bp0 = 2549;
+                    int32 bp0 = sNaxx40Tuning->Roll(TUNING_LOATHEB_INEVITABLE_DOOM);
 
                     if (me->CastCustomSpell(me, SPELL_INEVITABLE_DOOM, &bp0, 0, 0, false) == SPELL_CAST_OK)
                     {
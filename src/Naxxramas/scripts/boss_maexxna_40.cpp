@@ -23,6 +23,10 @@
 #include "SpellScript.h"
 #include "SpellScriptLoader.h"
 #include "naxxramas.h"
+#include "naxxramas_40_instance.h"
+#include "naxxramas_40_profiler.h"
+#include "naxxramas_40_targeting.h"
+#include "naxxramas_40_tuning.h"
 
 enum Spells
 {
@@ -75,24 +79,6 @@ const Position PosWrap[7] =
     {3560.282f,  -3886.143f,  321.2827f}
 };
 
-struct WebTargetSelector
-{
-    WebTargetSelector(Unit* maexxna) : _maexxna(maexxna) {}
-    bool operator()(Unit const* target) const
-    {
-        if (!target->IsPlayer()) // never web nonplayers (pets, guardians, etc.)
-            return false;
-        if (_maexxna->GetVictim() == target) // never target tank
-            return false;
-        if (target->HasAura(SPELL_WEB_WRAP_STUN)) // never target targets that are already webbed
-            return false;
-        return true;
-    }
-
-    private:
-        Unit const* _maexxna;
-};
-
 class boss_maexxna_40 : public CreatureScript
 {
 public:
@@ -128,6 +114,7 @@ public:
             BossAI::Reset();
             events.Reset();
             summons.DespawnAll();
+            DespawnNaxxramasPool(me, NPC_MAEXXNA_SPIDERLING);
         }
 
         void JustEngagedWith(Unit* who) override
@@ -155,6 +142,13 @@ public:
             summons.Summon(cr);
         }
 
+        void SummonedCreatureDies(Creature* cr, Unit*) override
+        {
+            // Corpses that are not pooled stay in the summon list to be despawned on reset
+            if (cr->GetEntry() == NPC_MAEXXNA_SPIDERLING && ReleaseNaxxramasCreature(cr))
+                summons.Despawn(cr);
+        }
+
         void KilledUnit(Unit* who) override
         {
             if (who->IsPlayer())
@@ -164,32 +158,25 @@ public:
         void JustDied(Unit*  killer) override
         {
             BossAI::JustDied(killer);
+            DespawnNaxxramasPool(me, NPC_MAEXXNA_SPIDERLING);
         }
 
         void DoCastWebWrap()
         {
-            std::list<Unit*> candidates;
-            SelectTargetList(candidates, RAID_MODE(1, 2, 2, 2), SelectTargetMethod::Random, 0, WebTargetSelector(me));
+            // Never the tank, pets or guardians, nor players who are already webbed
+            auto targets = SelectRandomThreat<2>(me->GetThreatMgr(), RAID_MODE(1, 2, 2, 2),
+                NaxxTarget::AllOf(NaxxTarget::IsPlayer(), NaxxTarget::NotTank{ me }, NaxxTarget::NotAura{ SPELL_WEB_WRAP_STUN }));
+
+            if (targets.empty())
+                return;
 
             std::vector<uint32> positions {0, 1, 2, 3, 4, 5, 6};
             Acore::Containers::RandomShuffle(positions);
 
-            if (candidates.empty())
-                return;
-
-            for (int i = 0; i < RAID_MODE(1, 2, 2, 2); i++)
+            for (std::size_t i = 0; i < targets.size(); ++i)
             {
-                if (candidates.empty())
-                    break;
                 const Position &randomPos = PosWrap[positions[i]];
-
-                auto itr = candidates.begin();
-
-                if (candidates.size() > 1)
-                    std::advance(itr, urand(0, candidates.size() - 1));
-
-                Unit *target = *itr;
-                candidates.erase(itr);
+                Unit *target = targets[i];
 
                 float dx = randomPos.GetPositionX() - target->GetPositionX();
                 float dy = randomPos.GetPositionY() - target->GetPositionY();
@@ -217,6 +204,8 @@ public:
 
         void UpdateAI(uint32 diff) override
         {
+            EncounterProfileScope profile(instance, BOSS_MAEXXNA);
+
             if (!IsInRoom())
                 return;
 
@@ -227,7 +216,9 @@ public:
             if (me->HasUnitState(UNIT_STATE_CASTING))
                 return;
 
-            switch (events.ExecuteEvent())
+            uint32 eventId = events.ExecuteEvent();
+            profile.SetEvent(eventId);
+            switch (eventId)
             {
                 case EVENT_WEB_SPRAY:
                     Talk(EMOTE_WEB_SPRAY);
@@ -246,7 +237,7 @@ public:
                     Talk(EMOTE_SPIDERS);
                     for (uint8 i = 0; i < 8; ++i)
                     {
-                        me->SummonCreature(NPC_MAEXXNA_SPIDERLING, me->GetPositionX(), me->GetPositionY(), me->GetPositionZ(), me->GetOrientation());
+                        SummonNaxxramasCreature(me, NPC_MAEXXNA_SPIDERLING, me->GetPosition());
                     }
                     events.Repeat(40s);
                     break;
@@ -347,14 +338,14 @@ public:
 
     void OnPeriodic(AuraEffect const* aurEff)
     {
-        if (GetCaster()->GetMap()->GetDifficulty() == RAID_DIFFICULTY_10MAN_HEROIC)
+        if (IsNaxx40(GetCaster()))
         {
             AuraEffect* eff = const_cast<AuraEffect*>(aurEff);
-            eff->SetAmount(static_cast<int32>(urand(657, 843)));
+            eff->SetAmount(sNaxx40Tuning->Roll(TUNING_MAEXXNA_WEB_WRAP));
         }
         if (aurEff->GetTickNumber() == 2)
         {
-            if (GetCaster()->GetMap()->GetDifficulty() == RAID_DIFFICULTY_10MAN_HEROIC)
+            if (IsNaxx40(GetCaster()))
                 GetTarget()->CastSpell(GetTarget(), SPELL_WEB_WRAP_SUMMON_40, true);
             else
                 GetTarget()->CastSpell(GetTarget(), SPELL_WEB_WRAP_SUMMON, true);
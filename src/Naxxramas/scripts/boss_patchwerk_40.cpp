@@ -18,6 +18,9 @@
 #include "CreatureScript.h"
 #include "ScriptedCreature.h"
 #include "naxxramas.h"
+#include "naxxramas_40_profiler.h"
+#include "naxxramas_40_targeting.h"
+#include "naxxramas_40_tuning.h"
 
 enum Yells
 {
@@ -103,6 +106,8 @@ public:
 
         void UpdateAI(uint32 diff) override
         {
+            EncounterProfileScope profile(instance, BOSS_PATCHWERK);
+
             if (!UpdateVictim())
                 return;
 
@@ -110,52 +115,35 @@ public:
             if (me->HasUnitState(UNIT_STATE_CASTING))
                 return;
 
-            switch (events.ExecuteEvent())
+            uint32 eventId = events.ExecuteEvent();
+            profile.SetEvent(eventId);
+            switch (eventId)
             {
                 case EVENT_HATEFUL_STRIKE:
                    {
-                        // Cast Hateful strike on the player with the highest amount of HP within melee distance, and second threat amount
-                        std::list<Unit*> meleeRangeTargets;
-                        Unit* finalTarget = nullptr;
-                        uint8 counter = 0;
-                        auto i = me->GetThreatMgr().GetThreatList().begin();
-                        for (; i != me->GetThreatMgr().GetThreatList().end(); ++i, ++counter)
+                        // Cast Hateful strike on the player with the highest amount of HP within melee distance, and second threat amount.
+                        // Only the three most hated units in melee range matter, if there are fewer than three the list was walked entirely.
+                        FixedVector<Unit*, 3> meleeRangeTargets = SelectTopThreat<3>(me->GetThreatMgr(), [this](Unit* target)
                         {
-                            // Gather all units with melee range
-                            Unit* target = (*i)->getTarget();
-                            if (me->IsWithinMeleeRange(target))
-                            {
-                                meleeRangeTargets.push_back(target);
-                            }
-                            // and add threat to most hated
-                            if (counter < 3)
-                            {
-                                me->AddThreat(target, 500.0f);
-                            }
-                        }
-                        counter = 0;
-                        std::list<Unit*, std::allocator<Unit*>>::iterator itr;
-                        for (itr = meleeRangeTargets.begin(); itr != meleeRangeTargets.end(); ++itr, ++counter)
+                            return me->IsWithinMeleeRange(target);
+                        });
+
+                        // and add threat to most hated
+                        for (Unit* target : SelectTopThreat<3>(me->GetThreatMgr()))
+                            me->AddThreat(target, 500.0f);
+
+                        Unit* finalTarget = nullptr;
+                        if (meleeRangeTargets.size() == 1) // if there is only one target available
+                            finalTarget = meleeRangeTargets[0];
+                        else // skip first target
                         {
-                            // if there is only one target available
-                            if (meleeRangeTargets.size() == 1)
-                            {
-                                finalTarget = (*itr);
-                            }
-                            else if (counter > 0) // skip first target
-                            {
-                                if (!finalTarget || (*itr)->GetHealth() > finalTarget->GetHealth())
-                                {
-                                    finalTarget = (*itr);
-                                }
-                                // third loop
-                                if (counter >= 2)
-                                    break;
-                            }
+                            for (std::size_t i = 1; i < meleeRangeTargets.size(); ++i)
+                                if (!finalTarget || meleeRangeTargets[i]->GetHealth() > finalTarget->GetHealth())
+                                    finalTarget = meleeRangeTargets[i];
                         }
                         if (finalTarget)
                         {
-                            int32 dmg = urand(22100,22850);
+                            int32 dmg = sNaxx40Tuning->Roll(TUNING_PATCHWERK_HATEFUL_STRIKE);
                             me->CastCustomSpell(finalTarget, SPELL_HATEFUL_STRIKE_10, &dmg, 0, 0, false);
                         }
                         events.Repeat(1200ms);
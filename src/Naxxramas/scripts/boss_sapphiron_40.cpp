@@ -20,6 +20,11 @@
 #include "ScriptedCreature.h"
 #include "SpellScript.h"
 #include "naxxramas.h"
+#include "naxxramas_40_instance.h"
+#include "naxxramas_40_profiler.h"
+#include "naxxramas_40_targeting.h"
+#include "naxxramas_40_tuning.h"
+#include <cmath>
 
 enum Yells
 {
@@ -79,8 +84,55 @@ enum Events
     EVENT_FLIGHT_SPELL_EXPLOSION    = 10,
     EVENT_FLIGHT_START_LAND         = 11,
     EVENT_LAND                      = 12,
-    EVENT_GROUND                    = 13,
-    EVENT_HUNDRED_CLUB              = 14
+    EVENT_GROUND                    = 13
+};
+
+static constexpr float IceBlockShadowHalfWidth = 2.0f;
+static constexpr float IceBlockShadowLength    = 10.0f;
+static constexpr uint8 IceBlockMaxCount        = 3;
+
+// Shelter the ice blocks give from the frost explosion, as angular intervals seen from Sapphiron.
+// Built once when the breath starts, the blocks are stunned players and do not move until it hits,
+// so checking a target is a few angle comparisons instead of a geometric test against every block.
+class IceBlockShadows
+{
+public:
+    void Add(Unit const* sapphiron, Unit const* block)
+    {
+        float dist = sapphiron->GetExactDist2d(block);
+        if (dist <= IceBlockShadowHalfWidth)
+            return;
+
+        _shadows.push_back({ sapphiron->GetAngle(block), std::asin(IceBlockShadowHalfWidth / dist), dist, dist + IceBlockShadowLength });
+    }
+
+    void Clear() { _shadows.clear(); }
+
+    // Behind a block as seen from Sapphiron, and close enough to it
+    bool IsSheltered(Unit const* sapphiron, WorldObject const* target) const
+    {
+        if (_shadows.empty())
+            return false;
+
+        float dist = sapphiron->GetExactDist2d(target);
+        float angle = sapphiron->GetAngle(target);
+        for (Shadow const& shadow : _shadows)
+            if (dist > shadow.minDist && dist <= shadow.maxDist && std::fabs(std::remainder(angle - shadow.angle, 2 * float(M_PI))) <= shadow.halfAngle)
+                return true;
+
+        return false;
+    }
+
+private:
+    struct Shadow
+    {
+        float angle;
+        float halfAngle;
+        float minDist; // from Sapphiron
+        float maxDist;
+    };
+
+    FixedVector<Shadow, IceBlockMaxCount> _shadows;
 };
 
 // Unlike other Naxx 40 scripts, this overwrites all versions of the UI
@@ -103,13 +155,15 @@ public:
 
     struct boss_sapphiron_40AI : public BossAI
     {
-        explicit boss_sapphiron_40AI(Creature* c) : BossAI(c, BOSS_SAPPHIRON)
+        explicit boss_sapphiron_40AI(Creature* c) : BossAI(c, BOSS_SAPPHIRON), iceboltTargets(GetNaxxramasRoster(instance))
         {}
 
         EventMap events;
         uint8 iceboltCount{};
         uint32 spawnTimer{};
         GuidList blockList;
+        RaidMemberSet iceboltTargets; // players in blockList
+        IceBlockShadows iceBlockShadows;
         ObjectGuid currentTarget;
 
         void InitializeAI() override
@@ -146,29 +200,21 @@ public:
             spawnTimer = 0;
             currentTarget.Clear();
             blockList.clear();
+            iceboltTargets.Clear();
+            iceBlockShadows.Clear();
         }
 
         void EnterCombatSelfFunction()
         {
-            Map::PlayerList const& PlList = me->GetMap()->GetPlayers();
-            if (PlList.IsEmpty())
-                return;
-
-            for (auto const& i : PlList)
+            GetNaxxramasRoster(instance).ForEachActive([this](Player* player)
             {
-                if (Player* player = i.GetSource())
+                if (me->GetDistance(player) < 80.0f)
                 {
-                    if (player->IsGameMaster())
-                        continue;
-
-                    if (player->IsAlive() && me->GetDistance(player) < 80.0f)
-                    {
-                        me->SetInCombatWith(player);
-                        player->SetInCombatWith(me);
-                        me->AddThreat(player, 0.0f);
-                    }
+                    me->SetInCombatWith(player);
+                    player->SetInCombatWith(me);
+                    me->AddThreat(player, 0.0f);
                 }
-            }
+            });
         }
 
         void JustEngagedWith(Unit* who) override
@@ -182,7 +228,6 @@ public:
             events.ScheduleEvent(EVENT_LIFE_DRAIN, 17s);
             events.ScheduleEvent(EVENT_BLIZZARD, 17s);
             events.ScheduleEvent(EVENT_FLIGHT_START, 45s);
-            events.ScheduleEvent(EVENT_HUNDRED_CLUB, 5s);
         }
 
         void JustDied(Unit*  killer) override
@@ -217,18 +262,11 @@ public:
 
         bool IsValidExplosionTarget(WorldObject* target)
         {
-            for (ObjectGuid const& guid : blockList)
-            {
-                if (target->GetGUID() == guid)
-                    return false;
+            Unit* unit = target->ToUnit();
+            if (unit && iceboltTargets.Contains(unit))
+                return false;
 
-                if (Unit* block = ObjectAccessor::GetUnit(*me, guid))
-                {
-                    if (block->IsInBetween(me, target, 2.0f) && block->IsWithinDist(target, 10.0f))
-                        return false;
-                }
-            }
-            return true;
+            return !iceBlockShadows.IsSheltered(me, target);
         }
 
         void KilledUnit(Unit* who) override
@@ -239,6 +277,8 @@ public:
 
         void UpdateAI(uint32 diff) override
         {
+            EncounterProfileScope profile(instance, BOSS_SAPPHIRON);
+
             if (spawnTimer)
             {
                 spawnTimer += diff;
@@ -262,7 +302,9 @@ public:
             if (me->HasUnitState(UNIT_STATE_CASTING))
                 return;
 
-            switch (events.ExecuteEvent())
+            uint32 eventId = events.ExecuteEvent();
+            profile.SetEvent(eventId);
+            switch (eventId)
             {
                 case EVENT_BERSERK:
                     Talk(EMOTE_ENRAGE);
@@ -280,7 +322,7 @@ public:
                     if (isNaxx40Sapp(me->GetEntry()))
                     {
                         CustomSpellValues values;
-                        int32 bp0 = 1700;
+                        int32 bp0 = sNaxx40Tuning->Roll(TUNING_SAPPHIRON_LIFE_DRAIN);
                         values.AddSpellMod(SPELLVALUE_BASE_POINT0, bp0);
                         values.AddSpellMod(SPELLVALUE_MAX_TARGETS, 5);
                         me->CastCustomSpell(SPELL_LIFE_DRAIN, values, me, TRIGGERED_NONE, nullptr, nullptr, ObjectGuid::Empty);
@@ -342,40 +384,15 @@ public:
                             }
                         }
 
-                        std::vector<Unit*> targets;
-                        auto i = me->GetThreatMgr().GetThreatList().begin();
-                        for (; i != me->GetThreatMgr().GetThreatList().end(); ++i)
+                        Unit* target = iceboltCount ? SelectRandomThreatTarget(me->GetThreatMgr(), NaxxTarget::AllOf(NaxxTarget::IsPlayer(), NaxxTarget::NotInSet{ iceboltTargets })) : nullptr;
+                        if (target)
                         {
-                            if ((*i)->getTarget()->IsPlayer())
-                            {
-                                bool inList = false;
-                                if (!blockList.empty())
-                                {
-                                    for (GuidList::const_iterator itr = blockList.begin(); itr != blockList.end(); ++itr)
-                                    {
-                                        if ((*i)->getTarget()->GetGUID() == *itr)
-                                        {
-                                            inList = true;
-                                            break;
-                                        }
-                                    }
-                                }
-                                if (!inList)
-                                {
-                                    targets.push_back((*i)->getTarget());
-                                }
-                            }
-                        }
-
-                        if (!targets.empty() && iceboltCount)
-                        {
-                            auto itr = targets.begin();
-                            advance(itr, urand(0, targets.size() - 1));
-                            me->CastSpell(*itr, SPELL_ICEBOLT_CAST, false);
-                            blockList.push_back((*itr)->GetGUID());
-                            currentTarget = (*itr)->GetGUID();
+                            me->CastSpell(target, SPELL_ICEBOLT_CAST, false);
+                            blockList.push_back(target->GetGUID());
+                            iceboltTargets.Insert(target);
+                            currentTarget = target->GetGUID();
                             --iceboltCount;
-                            events.ScheduleEvent(EVENT_FLIGHT_ICEBOLT, Seconds(uint32(me->GetExactDist(*itr) / 13.0f)));
+                            events.ScheduleEvent(EVENT_FLIGHT_ICEBOLT, Seconds(uint32(me->GetExactDist(target) / 13.0f)));
                         }
                         else
                         {
@@ -385,6 +402,10 @@ public:
                     }
                 case EVENT_FLIGHT_BREATH:
                     currentTarget.Clear();
+                    iceBlockShadows.Clear();
+                    for (ObjectGuid const& guid : blockList)
+                        if (Unit* block = ObjectAccessor::GetUnit(*me, guid))
+                            iceBlockShadows.Add(me, block);
                     Talk(EMOTE_BREATH);
                     me->CastSpell(me, SPELL_FROST_MISSILE, false);
                     events.ScheduleEvent(EVENT_FLIGHT_SPELL_EXPLOSION, 8500ms);
@@ -405,6 +426,8 @@ public:
                         }
                     }
                     blockList.clear();
+                    iceboltTargets.Clear();
+                    iceBlockShadows.Clear();
                     me->RemoveAllGameObjects();
                     events.ScheduleEvent(EVENT_LAND, 1s);
                     return;
@@ -418,20 +441,6 @@ public:
                     me->SetReactState(REACT_AGGRESSIVE);
                     me->SetInCombatWithZone();
                     return;
-                case EVENT_HUNDRED_CLUB:
-                    {
-                        Map::PlayerList const& pList = me->GetMap()->GetPlayers();
-                        for (auto const& itr : pList)
-                        {
-                            if (itr.GetSource()->GetResistance(SPELL_SCHOOL_FROST) > 100)
-                            {
-                                instance->SetData(DATA_HUNDRED_CLUB, 0);
-                                return;
-                            }
-                        }
-                        events.Repeat(5s);
-                        return;
-                    }
             }
             DoMeleeAttackIfReady();
         }
@@ -449,19 +458,14 @@ class spell_sapphiron_frost_explosion : public SpellScript
         if (!caster || !caster->ToCreature())
             return;
 
-        std::list<WorldObject*> tmplist;
-        for (auto& target : targets)
-        {
-            if (CAST_AI(boss_sapphiron_40::boss_sapphiron_40AI, caster->ToCreature()->AI())->IsValidExplosionTarget(target))
-            {
-                tmplist.push_back(target);
-            }
-        }
-        targets.clear();
-        for (auto& itr : tmplist)
+        auto ai = CAST_AI(boss_sapphiron_40::boss_sapphiron_40AI, caster->ToCreature()->AI());
+        if (!ai)
+            return;
+
+        targets.remove_if([ai](WorldObject* target)
         {
-            targets.push_back(itr);
-        }
+            return !ai->IsValidExplosionTarget(target);
+        });
     }
 
     void Register() override
@@ -17,11 +17,15 @@
 
 #include "AreaTriggerScript.h"
 #include "CreatureScript.h"
+#include "GameTime.h"
 #include "Player.h"
 #include "ScriptMgr.h"
 #include "ScriptedCreature.h"
 #include "SpellScript.h"
 #include "naxxramas.h"
+#include "naxxramas_40_instance.h"
+#include "naxxramas_40_profiler.h"
+#include "naxxramas_40_tuning.h"
 
 enum Says
 {
@@ -101,10 +105,7 @@ enum Misc
 {
     ACTION_MAGNETIC_PULL                = 1,
     ACTION_SUMMON_DIED                  = 2,
-    ACTION_RESTORE                      = 3,
-    GO_TESLA_COIL_LEFT                  = 181478,
-    GO_TESLA_COIL_RIGHT                 = 181477,
-    NPC_TESLA_COIL                      = 16218
+    ACTION_RESTORE                      = 3
 };
 
 class boss_thaddius_40 : public CreatureScript
@@ -129,6 +130,16 @@ public:
         uint32 resetTimer{};
         bool ballLightningEnabled;
 
+        // Bound through the instance ObjectData, searched for only when the map did not load them
+        GameObject* GetTeslaCoil(uint32 data, uint32 entry)
+        {
+            if (GameObject* go = instance->GetGameObject(data))
+                return go;
+
+            CountEncounterGridSearch(instance, BOSS_THADDIUS);
+            return me->FindNearestGameObject(entry, 100.0f);
+        }
+
         void DoAction(int32 param) override
         {
             if (param == ACTION_SUMMON_DIED)
@@ -155,6 +166,8 @@ public:
             resetTimer = 1;
             me->SetPosition(me->GetHomePosition());
             ballLightningEnabled = false;
+            if (NaxxramasInstanceScript* naxxramas = GetNaxxramasInstance(instance))
+                naxxramas->GetPolarityGrid().Clear();
 
             me->SummonCreature(NPC_STALAGG_40, 3450.45f, -2931.42f, 312.091f, 5.49779f);
             me->SummonCreature(NPC_FEUGEN_40, 3508.14f, -2988.65f, 312.092f, 2.37365f);
@@ -177,11 +190,11 @@ public:
                 cr->SetControlled(true, UNIT_STATE_ROOT);
             }
 
-            if (GameObject* go = me->FindNearestGameObject(GO_TESLA_COIL_LEFT, 100.0f))
+            if (GameObject* go = GetTeslaCoil(DATA_TESLA_COIL_LEFT, GO_TESLA_COIL_LEFT))
             {
                 go->SetGoState(GO_STATE_ACTIVE);
             }
-            if (GameObject* go = me->FindNearestGameObject(GO_TESLA_COIL_RIGHT, 100.0f))
+            if (GameObject* go = GetTeslaCoil(DATA_TESLA_COIL_RIGHT, GO_TESLA_COIL_RIGHT))
             {
                 go->SetGoState(GO_STATE_ACTIVE);
             }
@@ -205,6 +218,8 @@ public:
         {
             BossAI::JustDied(killer);
             Talk(SAY_DEATH);
+            if (NaxxramasInstanceScript* naxxramas = GetNaxxramasInstance(instance))
+                naxxramas->GetPolarityGrid().Clear();
             instance->DoRemoveAurasDueToSpellOnPlayers(SPELL_POSITIVE_POLARITY);
             instance->DoRemoveAurasDueToSpellOnPlayers(SPELL_POSITIVE_CHARGE_STACK);
             instance->DoRemoveAurasDueToSpellOnPlayers(SPELL_NEGATIVE_POLARITY);
@@ -226,6 +241,8 @@ public:
 
         void UpdateAI(uint32 diff) override
         {
+            EncounterProfileScope profile(instance, BOSS_THADDIUS);
+
             if (resetTimer)
             {
                 resetTimer += diff;
@@ -275,7 +292,9 @@ public:
                 }
             }
 
-            switch (events.ExecuteEvent())
+            uint32 eventId = events.ExecuteEvent();
+            profile.SetEvent(eventId);
+            switch (eventId)
             {
                 case EVENT_THADDIUS_INIT:
                 {
@@ -291,11 +310,11 @@ public:
                             }
                         }
                     }
-                    if (GameObject* go = me->FindNearestGameObject(GO_TESLA_COIL_LEFT, 100.0f))
+                    if (GameObject* go = GetTeslaCoil(DATA_TESLA_COIL_LEFT, GO_TESLA_COIL_LEFT))
                     {
                         go->SetGoState(GO_STATE_READY);
                     }
-                    if (GameObject* go = me->FindNearestGameObject(GO_TESLA_COIL_RIGHT, 100.0f))
+                    if (GameObject* go = GetTeslaCoil(DATA_TESLA_COIL_RIGHT, GO_TESLA_COIL_RIGHT))
                     {
                         go->SetGoState(GO_STATE_READY);
                     }
@@ -305,6 +324,8 @@ public:
                 }
                 case EVENT_THADDIUS_ENTER_COMBAT:
                     Talk(SAY_AGGRO);
+                    if (NaxxramasInstanceScript* naxxramas = GetNaxxramasInstance(instance))
+                        naxxramas->GetPolarityGrid().Activate(SPELL_POSITIVE_POLARITY, SPELL_NEGATIVE_POLARITY);
                     me->SetReactState(REACT_AGGRESSIVE);
                     me->SetControlled(false, UNIT_STATE_STUNNED);
                     me->RemoveUnitFlag(UNIT_FLAG_NON_ATTACKABLE);
@@ -319,7 +340,7 @@ public:
                 case EVENT_THADDIUS_CHAIN_LIGHTNING:
                 {
                     CustomSpellValues values;
-                    int32 customChainLightningDamage = 1850; // (1850, 2150), die 675
+                    int32 customChainLightningDamage = sNaxx40Tuning->Roll(TUNING_THADDIUS_CHAIN_LIGHTNING); // (1850, 2150), die 675
                     values.AddSpellMod(SPELLVALUE_BASE_POINT0, customChainLightningDamage);
                     values.AddSpellMod(SPELLVALUE_MAX_TARGETS, 15);
                     me->CastCustomSpell(SPELL_CHAIN_LIGHTNING, values, me->GetVictim(), TRIGGERED_NONE, nullptr, nullptr, ObjectGuid::Empty);
@@ -343,7 +364,7 @@ public:
             {
                 if (Unit* target = SelectTarget(SelectTargetMethod::MaxThreat))
                 {
-                    int32 customBallLightningDamage = 6000;
+                    int32 customBallLightningDamage = sNaxx40Tuning->Roll(TUNING_THADDIUS_BALL_LIGHTNING);
                     me->CastCustomSpell(target, SPELL_BALL_LIGHTNING, &customBallLightningDamage, 0, 0, false);
                 }
             }
@@ -372,7 +393,17 @@ public:
         uint32 pullTimer{};
         uint32 visualTimer{};
         bool overload;
-        ObjectGuid myCoil;
+
+        // Bound by the instance when Thaddius summons it, searched for only when that failed
+        Creature* GetCoil()
+        {
+            InstanceScript* instance = me->GetInstanceScript();
+            if (Creature* cr = instance->GetCreature(me->GetEntry() == NPC_STALAGG_40 ? DATA_TESLA_COIL_STALAGG : DATA_TESLA_COIL_FEUGEN))
+                return cr->IsAlive() ? cr : nullptr;
+
+            CountEncounterGridSearch(instance, BOSS_THADDIUS);
+            return me->FindNearestCreature(NPC_TESLA_COIL, 150.0f);
+        }
 
         void Reset() override
         {
@@ -381,11 +412,10 @@ public:
             overload = false;
             events.Reset();
             me->SetControlled(false, UNIT_STATE_STUNNED);
-            if (Creature* cr = me->FindNearestCreature(NPC_TESLA_COIL, 150.0f))
+            if (Creature* cr = GetCoil())
             {
                 cr->CastSpell(cr, me->GetEntry() == NPC_STALAGG_40 ? SPELL_STALAGG_CHAIN : SPELL_FEUGEN_CHAIN, false);
                 cr->SetImmuneToPC(false);
-                myCoil = cr->GetGUID();
             }
         }
 
@@ -398,10 +428,6 @@ public:
         void JustEngagedWith(Unit* pWho) override
         {
             me->SetInCombatWithZone();
-            if (Creature* cr = me->FindNearestCreature(NPC_TESLA_COIL, 150.f, true))
-            {
-                myCoil = cr->GetGUID();
-            }
             if (me->GetEntry() == NPC_STALAGG_40)
             {
                 events.ScheduleEvent(EVENT_MINION_POWER_SURGE, 10s);
@@ -438,6 +464,7 @@ public:
                 if (!me->IsAlive())
                 {
                     me->Respawn();
+                    ApplyNaxxramasRaidSizeScaling(me);
                     me->SetInCombatWithZone();
                     Talk(me->GetEntry() == NPC_STALAGG_40 ? EMOTE_STAL_REVIVE : EMOTE_FEUG_REVIVE);
                 }
@@ -476,7 +503,7 @@ public:
                 if (visualTimer >= 3000)
                 {
                     visualTimer = 0;
-                    if (Creature* cr = me->FindNearestCreature(NPC_TESLA_COIL, 150.0f))
+                    if (Creature* cr = GetCoil())
                     {
                         cr->CastSpell(cr, me->GetEntry() == NPC_STALAGG_40 ? SPELL_STALAGG_CHAIN : SPELL_FEUGEN_CHAIN, false);
                     }
@@ -537,7 +564,7 @@ public:
                     break;
                 }
                 case EVENT_MINION_CHECK_DISTANCE:
-                    if (Creature* cr = ObjectAccessor::GetCreature(*me, myCoil))
+                    if (Creature* cr = GetCoil())
                     {
                         if (!me->GetHomePosition().IsInDist(me, 28) && me->IsInCombat())
                         {
@@ -551,7 +578,7 @@ public:
                             if (Unit* target = SelectTarget(SelectTargetMethod::Random, 0, 1000.f, true))
                             {
                                 cr->CastStop(SPELL_TESLA_SHOCK);
-                                int32 customTeslaShockDamage = 4374;
+                                int32 customTeslaShockDamage = sNaxx40Tuning->Roll(TUNING_THADDIUS_TESLA_SHOCK);
                                 cr->CastCustomSpell(target, SPELL_TESLA_SHOCK, &customTeslaShockDamage, 0, 0, true);
                             }
                             events.Repeat(1500ms);
@@ -583,16 +610,29 @@ class spell_thaddius_pos_neg_charge : public SpellScript
 
     void HandleTargets(std::list<WorldObject*>& targets)
     {
-        uint8 count = 0;
-        for (auto& ihit : targets)
+        uint32 count = 0;
+        NaxxramasInstanceScript* naxxramas = GetNaxxramasInstance(GetCaster()->GetInstanceScript());
+        if (naxxramas && naxxramas->GetPolarityGrid().IsActive())
+        {
+            // The charges of all players pulse in the same map update, the first one builds the grid for the others
+            PolarityGrid& grid = naxxramas->GetPolarityGrid();
+            grid.Refresh(naxxramas->GetRoster(), GameTime::GetGameTimeMS().count());
+
+            float radius = GetSpellInfo()->Effects[EFFECT_0].CalcRadius(GetCaster());
+            count = grid.CountNear(GetCaster(), GetSpellInfo()->Id == SPELL_POSITIVE_CHARGE, radius);
+        }
+        else
         {
-            if (ihit->GetGUID() != GetCaster()->GetGUID())
+            for (auto& ihit : targets)
             {
-                if (Player* target = ihit->ToPlayer())
+                if (ihit->GetGUID() != GetCaster()->GetGUID())
                 {
-                    if (target->HasAura(GetTriggeringSpell()->Id))
+                    if (Player* target = ihit->ToPlayer())
                     {
-                        ++count;
+                        if (target->HasAura(GetTriggeringSpell()->Id))
+                        {
+                            ++count;
+                        }
                     }
                 }
             }
@@ -623,9 +663,9 @@ class spell_thaddius_pos_neg_charge : public SpellScript
             target->GetInstanceScript()->SetData(DATA_CHARGES_CROSSED, 0);
         }
         // Adjust damage to 2000 from 4500 for naxx40
-        if (target->GetMap()->GetDifficulty() == RAID_DIFFICULTY_10MAN_HEROIC)
+        if (IsNaxx40(target))
         {
-            SetHitDamage(2000);
+            SetHitDamage(sNaxx40Tuning->Roll(TUNING_THADDIUS_CHARGE));
         }
     }
 
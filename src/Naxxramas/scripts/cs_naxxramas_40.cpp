@@ -0,0 +1,152 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Chat.h"
+#include "CommandScript.h"
+#include "Player.h"
+#include "naxxramas_40_instance.h"
+#include "naxxramas_40_tuning.h"
+
+using namespace Acore::ChatCommands;
+
+class naxxramas_40_commandscript : public CommandScript
+{
+public:
+    naxxramas_40_commandscript() : CommandScript("naxxramas_40_commandscript") { }
+
+    ChatCommandTable GetCommands() const override
+    {
+        static ChatCommandTable profileCommandTable =
+        {
+            { "show",  HandleProfileShowCommand,  SEC_GAMEMASTER, Console::No },
+            { "reset", HandleProfileResetCommand, SEC_GAMEMASTER, Console::No }
+        };
+
+        static ChatCommandTable naxx40CommandTable =
+        {
+            { "profile", profileCommandTable },
+            { "pool",    HandlePoolCommand, SEC_GAMEMASTER, Console::No }
+        };
+
+        static ChatCommandTable reloadCommandTable =
+        {
+            { "naxx40_tuning", HandleReloadTuningCommand, SEC_ADMINISTRATOR, Console::Yes }
+        };
+
+        static ChatCommandTable commandTable =
+        {
+            { "naxx40", naxx40CommandTable },
+            { "reload", reloadCommandTable }
+        };
+
+        return commandTable;
+    }
+
+    static NaxxramasInstanceScript* GetInstance(ChatHandler* handler)
+    {
+        NaxxramasInstanceScript* instance = GetNaxxramasInstance(handler->GetPlayer()->GetInstanceScript());
+        if (!instance)
+            handler->SendErrorMessage("You are not inside Naxxramas.");
+
+        return instance;
+    }
+
+    static bool HandleProfileShowCommand(ChatHandler* handler)
+    {
+        NaxxramasInstanceScript* instance = GetInstance(handler);
+        if (!instance)
+            return false;
+
+        EncounterProfiler* profiler = instance->GetEncounterProfiler();
+        if (!profiler)
+        {
+            handler->SendErrorMessage("Encounter profiling is disabled (VanillaNaxxramas.Naxxramas.EncounterProfiling).");
+            return false;
+        }
+
+        bool empty = true;
+        profiler->ForEachRecorded([handler, &empty](uint32 bossId, uint32 eventId, EncounterHistogram const& histogram)
+        {
+            handler->PSendSysMessage("{} {}: {} calls, p50 {}us, p99 {}us, max {}us", EncounterProfiler::GetBossName(bossId),
+                EncounterProfiler::GetEventName(bossId, eventId),
+                histogram.GetCount(), histogram.GetPercentile(0.5f), histogram.GetPercentile(0.99f), histogram.GetMax());
+            empty = false;
+        });
+
+        for (uint32 bossId = 0; bossId < EncounterProfiledBosses; ++bossId)
+            if (uint32 searches = profiler->GetGridSearches(bossId))
+                handler->PSendSysMessage("{}: {} grid searches, {} per minute", EncounterProfiler::GetBossName(bossId), searches, profiler->GetGridSearchesPerMinute(bossId));
+
+        if (empty)
+            handler->SendSysMessage("No encounter samples recorded yet.");
+
+        return true;
+    }
+
+    static bool HandlePoolCommand(ChatHandler* handler)
+    {
+        NaxxramasInstanceScript* instance = GetInstance(handler);
+        if (!instance)
+            return false;
+
+        SummonPool* pool = instance->GetSummonPool();
+        if (!pool)
+        {
+            handler->SendErrorMessage("Summon pooling is disabled (VanillaNaxxramas.Naxxramas.SummonPooling).");
+            return false;
+        }
+
+        handler->PSendSysMessage("Summon pool: {} hits, {} misses, {} corpses waiting for reuse.", pool->GetHits(), pool->GetMisses(), pool->GetFreeCount());
+        return true;
+    }
+
+    static bool HandleProfileResetCommand(ChatHandler* handler)
+    {
+        NaxxramasInstanceScript* instance = GetInstance(handler);
+        if (!instance)
+            return false;
+
+        EncounterProfiler* profiler = instance->GetEncounterProfiler();
+        if (!profiler)
+        {
+            handler->SendErrorMessage("Encounter profiling is disabled (VanillaNaxxramas.Naxxramas.EncounterProfiling).");
+            return false;
+        }
+
+        profiler->Reset();
+        handler->SendSysMessage("Encounter profile reset.");
+        return true;
+    }
+
+    static bool HandleReloadTuningCommand(ChatHandler* handler)
+    {
+        Player* player = handler->GetPlayer();
+        if (!sNaxx40Tuning->ReloadAsync(player ? player->GetGUID() : ObjectGuid::Empty))
+        {
+            handler->SendErrorMessage("A reload of naxx40_encounter_tuning is already pending.");
+            return false;
+        }
+
+        handler->SendSysMessage("Reloading naxx40_encounter_tuning, running encounters use the new values from their next event once it completes.");
+        return true;
+    }
+};
+
+void AddSC_naxxramas_40_commandscript()
+{
+    new naxxramas_40_commandscript();
+}
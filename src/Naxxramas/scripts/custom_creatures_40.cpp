@@ -4,6 +4,7 @@
 #include "SpellScript.h"
 #include "Player.h"
 #include "naxxramas.h"
+#include "naxxramas_40_tuning.h"
 
 class npc_naxx40_area_trigger : public CreatureScript
 {
@@ -132,7 +133,7 @@ public:
             {
                 if (me->GetDistance(me->GetVictim()) < 35.0f)
                 {
-                    int32 bp0 = 750; // damage
+                    int32 bp0 = sNaxx40Tuning->Roll(TUNING_HEIGAN_EYE_STALK_MIND_FLAY); // damage
                     int32 bp1 = -20; // movement speed
                     me->CastCustomSpell(me->GetVictim(), SPELL_MIND_FLAY, &bp0, &bp1, 0, false, nullptr, nullptr, ObjectGuid::Empty);
                 }
@@ -4,6 +4,8 @@
 #include "SpellAuraEffects.h"
 #include "SpellScript.h"
 #include "naxxramas.h"
+#include "naxxramas_40_instance.h"
+#include "naxxramas_40_tuning.h"
 #include "Player.h"
 
 // 28785 - Locust Swarm
@@ -26,12 +28,12 @@ class spell_anub_locust_swarm_aura_40 : public AuraScript
     void HandleTriggerSpell(AuraEffect const* /*aurEff*/)
     {
         Unit* caster = GetCaster();
-        if (!caster || (caster->GetMap()->GetDifficulty() != RAID_DIFFICULTY_10MAN_HEROIC))
+        if (!caster || !IsNaxx40(caster))
         {
             return;
         }
         PreventDefaultAction();
-        int32 modifiedLocustSwarmDamage = 812;
+        int32 modifiedLocustSwarmDamage = sNaxx40Tuning->Roll(TUNING_ANUBREKHAN_LOCUST_SWARM);
         CustomSpellValues values;
         values.AddSpellMod(SPELLVALUE_BASE_POINT0, modifiedLocustSwarmDamage);
         values.AddSpellMod(SPELLVALUE_RADIUS_MOD, 3000); // 30yd
@@ -58,20 +60,17 @@ class spell_gen_consumption : public SpellScript
             return;
         }
         int32 value = 0;
-        if (map->GetDifficulty() == RAID_DIFFICULTY_25MAN_NORMAL) // NAXX25 N
+        if (IsNaxx40(GetCaster())) // NAXX40
+        {
+            value = sNaxx40Tuning->Roll(TUNING_CONSUMPTION);
+        }
+        else if (map->GetDifficulty() == RAID_DIFFICULTY_25MAN_NORMAL) // NAXX25 N
         {
             value = urand(4500, 4700);
         }
-        else if (map->GetId() == 533) // NAXX10 N
+        else if (map->GetId() == 533 && map->GetDifficulty() == RAID_DIFFICULTY_10MAN_NORMAL) // NAXX10 N
         {
-            if (map->GetDifficulty() == RAID_DIFFICULTY_10MAN_NORMAL)
-            {
-                value = urand(3000, 3200);
-            }
-            else
-            {
-                value = urand(3960, 4840); // NAXX40
-            }
+            value = urand(3000, 3200);
         }
         else if (map->GetId() == 532) // Karazhan
         {
@@ -98,11 +97,11 @@ class spell_grobbulus_poison_cloud_poison_damage_40 : public SpellScript
     void HandleDamageCalc(SpellEffIndex /*effIndex*/)
     {
         Unit* caster = GetCaster();
-        if (!caster || (caster->GetMap()->GetDifficulty() != RAID_DIFFICULTY_10MAN_HEROIC))
+        if (!caster || !IsNaxx40(caster))
         {
             return;
         }
-        SetEffectValue(urand(1110, 1290));
+        SetEffectValue(sNaxx40Tuning->Roll(TUNING_GROBBULUS_POISON_CLOUD));
     }
 
     void Register() override
@@ -129,12 +128,12 @@ class spell_heigan_plague_cloud_aura_40 : public AuraScript
     void HandleTriggerSpell(AuraEffect const* /*aurEff*/)
     {
         Unit* caster = GetCaster();
-        if (!caster || (caster->GetMap()->GetDifficulty() != RAID_DIFFICULTY_10MAN_HEROIC))
+        if (!caster || !IsNaxx40(caster))
         {
             return;
         }
         PreventDefaultAction();
-        int32 bp0 = 4000;
+        int32 bp0 = sNaxx40Tuning->Roll(TUNING_HEIGAN_PLAGUE_CLOUD);
         caster->CastCustomSpell(caster, SPELL_PLAGUE_CLOUD_TRIGGER, &bp0, 0, 0, true);
     }
 
@@ -152,11 +151,11 @@ class spell_heigan_eruption_40 : public SpellScript
     void HandleDamageCalc(SpellEffIndex /*effIndex*/)
     {
         Unit* caster = GetCaster();
-        if (!caster || (caster->GetMap()->GetDifficulty() != RAID_DIFFICULTY_10MAN_HEROIC))
+        if (!caster || !IsNaxx40(caster))
         {
             return;
         }
-        SetEffectValue(urand(3500, 4500));
+        SetEffectValue(sNaxx40Tuning->Roll(TUNING_HEIGAN_ERUPTION));
     }
 
     void Register() override
@@ -195,11 +194,11 @@ class spell_kelthuzad_dark_blast_40 : public SpellScript
     void CalculateDamage(SpellEffIndex /*effIndex*/)
     {
         Unit* caster = GetCaster();
-        if (!caster || (caster->GetMap()->GetDifficulty() != RAID_DIFFICULTY_10MAN_HEROIC))
+        if (!caster || !IsNaxx40(caster))
         {
             return;
         }
-        SetEffectValue(urand(1750,2250));
+        SetEffectValue(sNaxx40Tuning->Roll(TUNING_KELTHUZAD_DARK_BLAST));
     }
 
     void Register() override
@@ -216,11 +215,11 @@ class spell_kelthuzad_frostbolt_40 : public SpellScript
     void CalculateDamage(SpellEffIndex /*effIndex*/)
     {
         Unit* caster = GetCaster();
-        if (!caster || (caster->GetMap()->GetDifficulty() != RAID_DIFFICULTY_10MAN_HEROIC))
+        if (!caster || !IsNaxx40(caster))
         {
             return;
         }
-        SetEffectValue(urand(2550,3450));
+        SetEffectValue(sNaxx40Tuning->Roll(TUNING_KELTHUZAD_FROSTBOLT));
     }
 
     void Register() override
@@ -237,11 +236,11 @@ class spell_sapphiron_icebolt_40 : public SpellScript
     void CalculateDamage(SpellEffIndex /*effIndex*/)
     {
         Unit* caster = GetCaster();
-        if (!caster || (caster->GetMap()->GetDifficulty() != RAID_DIFFICULTY_10MAN_HEROIC))
+        if (!caster || !IsNaxx40(caster))
         {
             return;
         }
-        SetEffectValue(urand(2625,3375));
+        SetEffectValue(sNaxx40Tuning->Roll(TUNING_SAPPHIRON_ICEBOLT));
     }
 
     void Register() override
@@ -258,7 +257,7 @@ class spell_sapphiron_frost_aura_40 : public AuraScript
     void CalculateAmount(AuraEffect const* /*aurEff*/, int32& amount, bool& /*canBeRecalculated*/)
     {
         Unit* caster = GetCaster();
-        if (!caster || (caster->GetMap()->GetDifficulty() != RAID_DIFFICULTY_10MAN_HEROIC))
+        if (!caster || !IsNaxx40(caster))
             return;
         if (urand(0, 99) == 0) // 1% chance to receive extra Frost Aura tick
             return;
@@ -279,11 +278,11 @@ class spell_patchwork_golem_war_stomp_40 : public SpellScript
     void CalculateDamage(SpellEffIndex /*effIndex*/)
     {
         Unit* caster = GetCaster();
-        if (!caster || (caster->GetMap()->GetDifficulty() != RAID_DIFFICULTY_10MAN_HEROIC))
+        if (!caster || !IsNaxx40(caster))
         {
             return;
         }
-        SetHitDamage(urand(936,1064));
+        SetHitDamage(sNaxx40Tuning->Roll(TUNING_PATCHWORK_GOLEM_WAR_STOMP));
     }
 
     void Register() override
@@ -310,14 +309,14 @@ class spell_noth_curse_of_the_plaguebringer_aura_40 : public AuraScript
         void HandleTriggerSpell(AuraEffect const* /*aurEff*/)
         {
             Unit* caster = GetCaster();
-            if (!caster || (caster->GetMap()->GetDifficulty() != RAID_DIFFICULTY_10MAN_HEROIC))
+            if (!caster || !IsNaxx40(caster))
             {
                 return;
             }
             PreventDefaultAction();
             CustomSpellValues values;
-            int32 bp0 = 1757; // instant damage
-            int32 bp1 = 874; // periodic damage
+            int32 bp0 = sNaxx40Tuning->Roll(TUNING_NOTH_PLAGUEBRINGER_INSTANT);
+            int32 bp1 = sNaxx40Tuning->Roll(TUNING_NOTH_PLAGUEBRINGER_PERIODIC);
             values.AddSpellMod(SPELLVALUE_BASE_POINT0, bp0);
             values.AddSpellMod(SPELLVALUE_BASE_POINT1, bp1);
             values.AddSpellMod(SPELLVALUE_RADIUS_MOD, 3500); // 35yd
@@ -338,11 +337,11 @@ class spell_razuvious_disrupting_shout_40 : public SpellScript
     void CalculateDamage(SpellEffIndex /*effIndex*/)
     {
         Unit* caster = GetCaster();
-        if (!caster || (caster->GetMap()->GetDifficulty() != RAID_DIFFICULTY_10MAN_HEROIC))
+        if (!caster || !IsNaxx40(caster))
         {
             return;
         }
-        SetEffectValue(urand(4050,4950));
+        SetEffectValue(sNaxx40Tuning->Roll(TUNING_RAZUVIOUS_DISRUPTING_SHOUT));
     }
 
     void Register() override
@@ -359,7 +358,7 @@ class spell_unholy_staff_arcane_explosion_40 : public SpellScript
     void PreventLaunchHit(SpellEffIndex effIndex)
     {
         Unit* caster = GetCaster();
-        if (!caster || (caster->GetMap()->GetDifficulty() != RAID_DIFFICULTY_10MAN_HEROIC))
+        if (!caster || !IsNaxx40(caster))
         {
             return;
         }
@@ -367,7 +366,7 @@ class spell_unholy_staff_arcane_explosion_40 : public SpellScript
         {
             if (target->IsWithinDist2d(caster, 20.0f))
             {
-                SetEffectValue(urand(1838, 2361));
+                SetEffectValue(sNaxx40Tuning->Roll(TUNING_UNHOLY_STAFF_ARCANE_EXPLOSION));
             }
             else
             {
@@ -390,11 +389,11 @@ class spell_disease_cloud_damage_40 : public SpellScript
     void HandleDamageCalc(SpellEffIndex /*effIndex*/)
     {
         Unit* caster = GetCaster();
-        if (!caster || (caster->GetMap()->GetDifficulty() != RAID_DIFFICULTY_10MAN_HEROIC))
+        if (!caster || !IsNaxx40(caster))
         {
             return;
         }
-        SetEffectValue(urand(278,322));
+        SetEffectValue(sNaxx40Tuning->Roll(TUNING_SEWAGE_SLIME_DISEASE_CLOUD));
     }
 
     void Register() override
@@ -411,7 +410,7 @@ class spell_feugen_static_field_40 : public SpellScript
     void HandleDamageCalc(SpellEffIndex /*effIndex*/)
     {
         Unit* caster = GetCaster();
-        if (!caster || (caster->GetMap()->GetDifficulty() != RAID_DIFFICULTY_10MAN_HEROIC))
+        if (!caster || !IsNaxx40(caster))
         {
             return;
         }
@@ -491,12 +490,8 @@ class isAllowedToCastSpell : public SpellScript
         if (!player)
             return SPELL_CAST_OK;
 
-        Map* map = player->GetMap();
-        if (!map)
-            return SPELL_CAST_OK;
-
         // Only enforce the check in Naxxramas 10HC (map 533, 10-man heroic).
-        if (map->GetId() != 533 || map->GetDifficulty() != RAID_DIFFICULTY_10MAN_HEROIC)
+        if (!IsNaxx40(player))
             return SPELL_CAST_OK;
 
         // Check class override auras (Corrupted Mind) on the player.
@@ -19,13 +19,25 @@
 #include "CellImpl.h"
 #include "CreatureAIImpl.h"
 #include "CreatureScript.h"
+#include "GridNotifiers.h"
+#include "Group.h"
 #include "InstanceMapScript.h"
 #include "InstanceScript.h"
 #include "PassiveAI.h"
 #include "Player.h"
+#include "Spell.h"
+#include "SpellAuras.h"
+#include "SpellInfo.h"
+#include "SpellMgr.h"
+#include "UnitScript.h"
 #include "naxxramas.h"
+#include "naxxramas_40_instance.h"
+#include "naxxramas_40_tuning.h"
+#include "Log.h"
 #include "ScriptMgr.h"
+#include "VanillaNaxxramas.h"
 #include "Map.h"
+#include "WorldPacket.h"
 #include "WorldSession.h"
 
 struct LivingPoisonData
@@ -42,6 +54,19 @@ static const LivingPoisonData LivingPoisonDataList[3]
     { Position { 3175.42, -3134.86, 293.34,  4.284   }, Position { 3158.778, -3164.201, 293.312 }, 14800 }
 };
 
+struct NaxxWingAnchor
+{
+    uint8 wing;
+    float x, y;
+};
+
+// A wing is occupied while a player is within DormantWingRadius of one of its anchors
+static NaxxWingAnchor const NaxxWingAnchors[]
+{
+    { NAXX_WING_CONSTRUCT_QUARTER, 3150.0f, -3140.0f }, // Living Poison hallway
+    { NAXX_WING_CONSTRUCT_QUARTER, 3480.0f, -2960.0f }  // Thaddius
+};
+
 static const float HeiganPos[2]
 {
     2796, -3707
@@ -113,6 +138,7 @@ static ObjectData const creatureData[]
     { NPC_THADDIUS,        DATA_THADDIUS_BOSS        },
     { NPC_RAZUVIOUS,       DATA_RAZUVIOUS_BOSS       },
     { NPC_GOTHIK,          DATA_GOTHIK_BOSS          },
+    { NPC_HEIGAN,          DATA_HEIGAN_BOSS          },
     { NPC_BARON_RIVENDARE, DATA_BARON_RIVENDARE_BOSS },
     { NPC_SIR_ZELIEK,      DATA_SIR_ZELIEK_BOSS      },
     { NPC_LADY_BLAUMEUX,   DATA_LADY_BLAUMEUX_BOSS   },
@@ -132,6 +158,7 @@ static ObjectData const creatureDataNX40[]
     { NPC_THADDIUS_40,          DATA_THADDIUS_BOSS        },
     { NPC_RAZUVIOUS_40,         DATA_RAZUVIOUS_BOSS       },
     { NPC_GOTHIK_40,            DATA_GOTHIK_BOSS          },
+    { NPC_HEIGAN_40,            DATA_HEIGAN_BOSS          },
     { NPC_HIGHLORD_MOGRAINE_40, DATA_BARON_RIVENDARE_BOSS },
     { NPC_SIR_ZELIEK_40,        DATA_SIR_ZELIEK_BOSS      },
     { NPC_LADY_BLAUMEUX_40,     DATA_LADY_BLAUMEUX_BOSS   },
@@ -156,13 +183,15 @@ static ObjectData const gameObjectData[]
     { GO_KELTHUZAD_PORTAL_2, DATA_KELTHUZAD_PORTAL_2 },
     { GO_KELTHUZAD_PORTAL_3, DATA_KELTHUZAD_PORTAL_3 },
     { GO_KELTHUZAD_PORTAL_4, DATA_KELTHUZAD_PORTAL_4 },
+    { GO_TESLA_COIL_LEFT,    DATA_TESLA_COIL_LEFT    },
+    { GO_TESLA_COIL_RIGHT,   DATA_TESLA_COIL_RIGHT   },
     { 0,                     0                       }
 };
 
-class instance_naxxramas : public InstanceScript
+class instance_naxxramas : public NaxxramasInstanceScript
 {
 public:
-    instance_naxxramas(Map* map) : InstanceScript(map)
+    instance_naxxramas(Map* map) : NaxxramasInstanceScript(map)
     {
         SetHeaders(DataHeader);
         SetBossNumber(MAX_ENCOUNTERS);
@@ -171,12 +200,12 @@ public:
         LoadObjectData(creatureData, gameObjectData);
 
         // NX40 specific data
-        if (instance->GetDifficulty() == RAID_DIFFICULTY_10MAN_HEROIC)
+        if (_traits.is40)
             LoadObjectData(creatureDataNX40, gameObjectData);
 
         // GameObjects
         for (auto& i : _heiganEruption)
-            i.clear();
+            i.reserve(HeiganEruptionsPerSection);
 
         // NPCs
         _patchwerkRoomTrash.clear();
@@ -187,6 +216,12 @@ public:
         _currentWingTaunt = SAY_FIRST_WING_TAUNT;
         _horsemanLoaded = 0;
         _thaddiusScreams = false;
+        _thaddiusScreamsPaused = false;
+
+        _events.ScheduleEvent(EVENT_ROSTER_REFRESH, 1s);
+
+        if (sVanillaNaxxramas->encounterProfiling && sVanillaNaxxramas->encounterProfilingLogInterval)
+            _events.ScheduleEvent(EVENT_ENCOUNTER_PROFILE_REPORT, Seconds(sVanillaNaxxramas->encounterProfilingLogInterval));
 
         // Achievements
         _abominationsKilled = 0;
@@ -196,6 +231,7 @@ public:
         _heiganAchievement = true;
         _sapphironAchievement = true;
         _horsemanAchievement = true;
+        _hundredClubTracked = false;
     }
 
     inline void CreatureTalk(uint32 dataCreature, uint8 dialog)
@@ -243,8 +279,47 @@ public:
         return 3;
     }
 
+    void LogEncounterProfile()
+    {
+        EncounterProfiler* profiler = GetEncounterProfiler();
+        if (!profiler)
+            return;
+
+        profiler->ForEachRecorded([this](uint32 bossId, uint32 eventId, EncounterHistogram const& histogram)
+        {
+            LOG_INFO("module", "Naxxramas instance {} {} {}: {} calls, p50 {}us, p99 {}us, max {}us",
+                instance->GetInstanceId(), EncounterProfiler::GetBossName(bossId), EncounterProfiler::GetEventName(bossId, eventId), histogram.GetCount(),
+                histogram.GetPercentile(0.5f), histogram.GetPercentile(0.99f), histogram.GetMax());
+        });
+    }
+
+    void ProfileEncounterState(uint32 bossId, EncounterState previousState, EncounterState state)
+    {
+        EncounterProfiler* profiler = GetEncounterProfiler();
+        if (!profiler || previousState == state)
+            return;
+
+        if (state == IN_PROGRESS)
+        {
+            profiler->BeginEncounter(bossId);
+            return;
+        }
+
+        if (previousState != IN_PROGRESS)
+            return;
+
+        EncounterHistogram ticks = profiler->GetEncounterTicks(bossId);
+        LOG_INFO("module", "Naxxramas instance {} {} {} after {}s: {} ticks, {}us total, mean {}us, p99 {}us, max {}us, {} grid searches/min",
+            instance->GetInstanceId(), EncounterProfiler::GetBossName(bossId), state == DONE ? "defeated" : "reset",
+            profiler->GetEncounterDuration(bossId).count(), ticks.GetCount(), ticks.GetTotal(), ticks.GetMean(),
+            ticks.GetPercentile(0.99f), ticks.GetMax(), profiler->GetGridSearchesPerMinute(bossId));
+    }
+
     inline void HeiganEruptSections(uint32 section)
     {
+        if (sVanillaNaxxramas->heiganBatchedEruption)
+            return HeiganEruptSectionsBatched(section);
+
         for (uint8 i = 0; i < HeiganEruptSectionCount; ++i)
         {
             if (i == section)
@@ -258,9 +333,101 @@ public:
         }
     }
 
+    // Caches the custom animation packets of a section and the range around its first fissure
+    // that covers every unit one of its fissures can hit
+    void BuildHeiganEruptionAnims(uint8 section, float radius)
+    {
+        std::vector<GameObject*> const& fissures = _heiganEruption[section];
+        std::vector<WorldPacket>& anims = _heiganEruptionAnim[section];
+        anims.clear();
+        anims.reserve(fissures.size());
+        _heiganEruptionRange[section] = 0.0f;
+        for (GameObject* go : fissures)
+        {
+            WorldPacket data(SMSG_GAMEOBJECT_CUSTOM_ANIM, 8 + 4);
+            data << go->GetGUID();
+            data << uint32(go->GetGoAnimProgress());
+            anims.push_back(std::move(data));
+
+            _heiganEruptionRange[section] = std::max(_heiganEruptionRange[section], fissures.front()->GetExactDist(go));
+        }
+
+        _heiganEruptionRange[section] += radius;
+        _heiganEruptionAnimDirty[section] = false;
+    }
+
+    // Eruption of a single fissure on a unit in its radius, dealt by Heigan as the spell
+    // script of Eruption would deal it
+    void HeiganEruptUnit(Creature* heigan, Unit* target, SpellInfo const* eruption)
+    {
+        if (target->IsImmunedToDamageOrSchool(eruption))
+            return;
+
+        int32 damage = _traits.is40 ? sNaxx40Tuning->Roll(TUNING_HEIGAN_ERUPTION) : eruption->Effects[EFFECT_0].CalcValue(heigan);
+        SpellNonMeleeDamage damageInfo(heigan, target, eruption, eruption->GetSchoolMask());
+        heigan->CalculateSpellDamageTaken(&damageInfo, damage, eruption);
+        Unit::DealDamageMods(damageInfo.target, damageInfo.damage, &damageInfo.absorb);
+        heigan->SendSpellNonMeleeDamageLog(&damageInfo);
+        heigan->DealSpellDamage(&damageInfo, true);
+    }
+
+    // HeiganEruptSections with one area search per erupting section instead of one per fissure:
+    // the units in reach of the section are collected once and every one of them within the
+    // Eruption radius of one of its fissures takes the damage once, where each fissure casting
+    // the spell searched the grid again and hit a unit between two fissures twice.
+    // Each section sends its animations as one update to the players watching the room. 3.3.5
+    // has no packet that groups several SMSG_GAMEOBJECT_CUSTOM_ANIM, so the update is the
+    // section's cached packets back to back, rebuilt only when a fissure spawns or despawns.
+    void HeiganEruptSectionsBatched(uint32 safeSection)
+    {
+        SpellInfo const* eruption = sSpellMgr->GetSpellInfo(SPELL_ERUPTION);
+        Creature* heigan = GetCreature(DATA_HEIGAN_BOSS);
+        if (!eruption || !heigan)
+            return;
+
+        float radius = eruption->Effects[EFFECT_0].CalcRadius();
+        for (uint8 section = 0; section < HeiganEruptSectionCount; ++section)
+        {
+            std::vector<GameObject*> const& fissures = _heiganEruption[section];
+            if (section == safeSection || fissures.empty())
+                continue;
+
+            if (_heiganEruptionAnimDirty[section])
+                BuildHeiganEruptionAnims(section, radius);
+
+            for (auto const& itr : instance->GetPlayers())
+                if (Player* player = itr.GetSource())
+                    if (player->IsWithinDist2d(HeiganPos[0], HeiganPos[1], instance->GetVisibilityRange()))
+                        for (WorldPacket const& anim : _heiganEruptionAnim[section])
+                            player->SendDirectMessage(&anim);
+
+            GameObject* center = fissures.front();
+            std::list<Unit*> units;
+            Acore::AnyUnitInObjectRangeCheck check(center, _heiganEruptionRange[section]);
+            Acore::UnitListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(center, units, check);
+            Cell::VisitAllObjects(center, searcher, _heiganEruptionRange[section]);
+
+            for (Unit* unit : units)
+            {
+                if (!heigan->IsValidAttackTarget(unit))
+                    continue;
+
+                bool inReach = std::any_of(fissures.begin(), fissures.end(), [unit, radius](GameObject* go)
+                {
+                    return go->IsWithinDist(unit, radius);
+                });
+
+                if (inReach)
+                    HeiganEruptUnit(heigan, unit, eruption);
+            }
+        }
+    }
+
     void OnPlayerEnter(Player* player) override
     {
         InstanceScript::OnPlayerEnter(player);
+        _roster.Add(player);
+        OnPlayerResistanceChange(player);
         if (_thaddiusScreams == false)
         {
             _events.ScheduleEvent(EVENT_THADDIUS_SCREAMS, 2min, 2min + 30s);
@@ -269,8 +436,68 @@ public:
         SetData(DATA_THADDIUS_SCREAMS, 0);
     }
 
+    void OnPlayerLeave(Player* player) override
+    {
+        InstanceScript::OnPlayerLeave(player);
+        _roster.Remove(player);
+    }
+
+    void OnUnitDeath(Unit* unit) override
+    {
+        InstanceScript::OnUnitDeath(unit);
+        if (Player* player = unit->ToPlayer())
+            _roster.SetAlive(player, false);
+    }
+
+    void UpdateWingOccupancy()
+    {
+        float radius = sVanillaNaxxramas->dormantWingRadius;
+        if (radius <= 0.0f)
+        {
+            _occupiedWings = 0xFF;
+            return;
+        }
+
+        uint8 occupied = 0;
+        for (RaidRosterEntry const& entry : _roster.GetEntries())
+            for (NaxxWingAnchor const& anchor : NaxxWingAnchors)
+                if (entry.player->GetExactDist2dSq(anchor.x, anchor.y) <= radius * radius)
+                    occupied |= 1 << anchor.wing;
+
+        uint8 awakened = occupied & ~_occupiedWings;
+        _occupiedWings = occupied;
+
+        if ((awakened & (1 << NAXX_WING_CONSTRUCT_QUARTER)) && _thaddiusScreamsPaused)
+        {
+            _thaddiusScreamsPaused = false;
+            _events.ScheduleEvent(EVENT_THADDIUS_SCREAMS, 2min, 2min + 30s);
+        }
+    }
+
+    void OnPlayerResistanceChange(Player* player) override
+    {
+        if (_hundredClubTracked)
+            _roster.MarkStatsDirty(player);
+    }
+
+    // The Hundred Club: fails as soon as a player goes above 100 frost resistance during Sapphiron
+    void CheckHundredClub()
+    {
+        _roster.ConsumeStatsDirty([this](Player* player)
+        {
+            if (_hundredClubTracked && player->GetResistance(SPELL_SCHOOL_FROST) > 100)
+            {
+                _sapphironAchievement = false;
+                _hundredClubTracked = false;
+            }
+        });
+    }
+
     void OnCreatureCreate(Creature* creature) override
     {
+        if (_traits.is40)
+            _raidSizeScaling.Apply(creature);
+
         switch (creature->GetEntry())
         {
             case NPC_ROTTING_MAGGOT_40:
@@ -306,6 +533,14 @@ public:
                 if (++_horsemanLoaded == HorsemanCount)
                     SetBossState(BOSS_HORSEMAN, GetBossState(BOSS_HORSEMAN));
                 break;
+            case NPC_TESLA_COIL:
+                // Both coils share their entry, bind each one to the minion it is linked to
+                AddObject(creature, GetTeslaCoilData(creature), true);
+                break;
+            case NPC_TRIGGER:
+                if (IsGothikGroundTrigger(creature))
+                    _gothikTriggers[creature->GetPositionY() < GothikGateY].push_back(creature->GetGUID());
+                break;
             default:
                 break;
         }
@@ -313,14 +548,48 @@ public:
         InstanceScript::OnCreatureCreate(creature);
     }
 
+    void OnCreatureRemove(Creature* creature) override
+    {
+        // The coils of the previous pull are removed after the new ones were summoned
+        if (creature->GetEntry() == NPC_TESLA_COIL && GetObjectGuid(GetTeslaCoilData(creature)) == creature->GetGUID())
+            AddObject(creature, GetTeslaCoilData(creature), false);
+
+        if (creature->GetEntry() == NPC_TRIGGER && IsGothikGroundTrigger(creature))
+        {
+            std::vector<ObjectGuid>& triggers = _gothikTriggers[creature->GetPositionY() < GothikGateY];
+            auto itr = std::find(triggers.begin(), triggers.end(), creature->GetGUID());
+            if (itr != triggers.end())
+            {
+                *itr = triggers.back();
+                triggers.pop_back();
+            }
+        }
+
+        InstanceScript::OnCreatureRemove(creature);
+    }
+
+    static bool IsGothikGroundTrigger(Creature* trigger)
+    {
+        return RaidRoster::GetRoom(*trigger) == BOSS_GOTHIK && trigger->GetPositionZ() <= GothikPlatformZ;
+    }
+
+    static uint32 GetTeslaCoilData(Creature* coil)
+    {
+        return coil->GetPositionX() > TeslaCoilSplitX ? DATA_TESLA_COIL_FEUGEN : DATA_TESLA_COIL_STALAGG;
+    }
+
     void OnGameObjectCreate(GameObject* go) override
     {
         switch (go->GetGOInfo()->displayId)
         {
             case GO_DISPLAY_ID_HEIGAN_ERUPTION1:
             case GO_DISPLAY_ID_HEIGAN_ERUPTION2:
-                _heiganEruption[GetEruptionSection(go->GetPositionX(), go->GetPositionY())].insert(go);
+            {
+                uint8 section = GetEruptionSection(go->GetPositionX(), go->GetPositionY());
+                _heiganEruption[section].push_back(go);
+                _heiganEruptionAnimDirty[section] = true;
                 break;
+            }
             default:
                 break;
         }
@@ -356,8 +625,19 @@ public:
         {
             case GO_DISPLAY_ID_HEIGAN_ERUPTION1:
             case GO_DISPLAY_ID_HEIGAN_ERUPTION2:
-                _heiganEruption[GetEruptionSection(go->GetPositionX(), go->GetPositionY())].erase(go);
+            {
+                // Order does not matter, swap with the last one instead of shifting the section
+                uint8 section = GetEruptionSection(go->GetPositionX(), go->GetPositionY());
+                std::vector<GameObject*>& fissures = _heiganEruption[section];
+                auto itr = std::find(fissures.begin(), fissures.end(), go);
+                if (itr != fissures.end())
+                {
+                    *itr = fissures.back();
+                    fissures.pop_back();
+                    _heiganEruptionAnimDirty[section] = true;
+                }
                 break;
+            }
             default:
                 break;
         }
@@ -377,7 +657,7 @@ public:
 
     bool CheckAchievementCriteriaMeet(uint32 criteria_id, Player const*  /*source*/, Unit const*  /*target*/, uint32  /*miscvalue1*/) override
     {
-        if (instance->GetDifficulty() == RAID_DIFFICULTY_10MAN_HEROIC)
+        if (_traits.is40)
             return false; // No achievements in Naxx 40
 
         switch (criteria_id)
@@ -488,8 +768,31 @@ public:
         }
     }
 
+    // Locks the raid size at the first boss pull and scales the creatures already spawned
+    void LockRaidSize()
+    {
+        uint8 players = 0;
+        for (RaidRosterEntry const& entry : _roster.GetEntries())
+            if (!entry.player->IsGameMaster())
+                ++players;
+
+        _raidSizeScaling.Lock(players);
+        if (!_raidSizeScaling.IsLocked())
+            return;
+
+        for (auto const& [spawnId, creature] : instance->GetCreatureBySpawnIdStore())
+            _raidSizeScaling.Apply(creature);
+
+        RaidScaleCoefficients const& coefficients = _raidSizeScaling.GetCoefficients();
+        LOG_INFO("module", "Naxxramas instance {} scaled to {} players: health x{:.2f}, damage x{:.2f}, armor x{:.2f}",
+            instance->GetInstanceId(), players, coefficients.health, coefficients.damage, coefficients.armor);
+    }
+
     bool SetBossState(uint32 bossId, EncounterState state) override
     {
+        if (state == IN_PROGRESS && _traits.is40 && !_raidSizeScaling.IsLocked())
+            LockRaidSize();
+
         switch (bossId)
         {
             case BOSS_PATCHWERK:
@@ -590,6 +893,7 @@ public:
                             {
                                 cr->SetPosition(cr->GetHomePosition());
                                 cr->Respawn();
+                                _raidSizeScaling.Apply(cr);
                             }
                         }
 
@@ -630,6 +934,11 @@ public:
             }
             case BOSS_SAPPHIRON:
             {
+                // No achievements in Naxx 40, nothing to track there
+                _hundredClubTracked = state == IN_PROGRESS && _sapphironAchievement && !_traits.is40;
+                if (_hundredClubTracked)
+                    _roster.MarkAllStatsDirty();
+
                 switch (state)
                 {
                     case NOT_STARTED:
@@ -662,11 +971,19 @@ public:
                 break;
         }
 
-        return InstanceScript::SetBossState(bossId, state);
+        EncounterState previousState = GetBossState(bossId);
+        if (!InstanceScript::SetBossState(bossId, state))
+            return false;
+
+        ProfileEncounterState(bossId, previousState, state);
+        return true;
     }
 
     void Update(uint32 diff) override
     {
+        if (_hundredClubTracked && _roster.HasStatsDirty())
+            CheckHundredClub();
+
         _events.Update(diff);
 
         switch (_events.ExecuteEvent())
@@ -676,6 +993,13 @@ public:
                 if (GetBossState(BOSS_THADDIUS) == DONE)
                     break;
 
+                // Resumed by UpdateWingOccupancy once a player is back in the wing
+                if (!IsWingOccupied(NAXX_WING_CONSTRUCT_QUARTER))
+                {
+                    _thaddiusScreamsPaused = true;
+                    break;
+                }
+
                 instance->PlayDirectSoundToMap(SOUND_SCREAM + urand(0, 3));
                 return _events.ScheduleEvent(EVENT_THADDIUS_SCREAMS, 2min, 2min + 30s);
             }
@@ -733,6 +1057,15 @@ public:
             case EVENT_KELTHUZAD_LICH_KING_TALK6:
                 CreatureTalk(DATA_KELTHUZAD_BOSS, SAY_SAPP_DIALOG6);
                 return SetGoState(DATA_KELTHUZAD_GATE, GO_STATE_ACTIVE);
+            case EVENT_ROSTER_REFRESH:
+                _roster.Refresh();
+                UpdateWingOccupancy();
+                return _events.Repeat(1s);
+            case EVENT_ENCOUNTER_PROFILE_REPORT:
+                LogEncounterProfile();
+                if (sVanillaNaxxramas->encounterProfilingLogInterval)
+                    _events.ScheduleEvent(EVENT_ENCOUNTER_PROFILE_REPORT, Seconds(sVanillaNaxxramas->encounterProfilingLogInterval));
+                return;
             default:
                 break;
         }
@@ -744,9 +1077,13 @@ private:
     uint8 _currentWingTaunt;
     uint8 _horsemanLoaded;
     bool _thaddiusScreams;
+    bool _thaddiusScreamsPaused;
 
     // GameObjects
-    std::set<GameObject*> _heiganEruption[HeiganEruptSectionCount];
+    std::array<std::vector<GameObject*>, HeiganEruptSectionCount> _heiganEruption;
+    std::array<std::vector<WorldPacket>, HeiganEruptSectionCount> _heiganEruptionAnim;
+    std::array<bool, HeiganEruptSectionCount> _heiganEruptionAnimDirty{};
+    std::array<float, HeiganEruptSectionCount> _heiganEruptionRange{};
 
     // NPCs
     GuidList _patchwerkRoomTrash;
@@ -758,6 +1095,7 @@ private:
     bool _thaddiusAchievement;
     bool _loathebAchievement;
     bool _sapphironAchievement;
+    bool _hundredClubTracked;
     bool _heiganAchievement;
     bool _horsemanAchievement;
 };
@@ -781,22 +1119,74 @@ public:
     }
 };
 
+static constexpr float LivingPoisonExplodeRange = 1.5f;
+
 class npc_living_poison : public NullCreatureAI
 {
 public:
-    npc_living_poison(Creature* c) : NullCreatureAI(c) { }
+    npc_living_poison(Creature* c) : NullCreatureAI(c), _instance(GetNaxxramasInstance(c->GetInstanceScript())) { }
 
-    void UpdateAI(uint32 /*diff*/) override
+    // Called by the map when the poison or a unit near it moved
+    void MoveInLineOfSight(Unit* who) override
     {
-        if (me->SelectNearestTarget(1.5f, true))
-            me->CastSpell(me, SPELL_EXPLODE, true);
+        if (!_exploded && CanExplodeOn(who))
+            Explode();
     }
+
+    void UpdateAI(uint32 diff) override
+    {
+        if (_exploded)
+            return;
+
+        // Nobody left to walk into, the spawner brings new ones when the wing is occupied again
+        if (_instance && !_instance->IsWingOccupied(NAXX_WING_CONSTRUCT_QUARTER))
+        {
+            me->DespawnOrUnsummon();
+            return;
+        }
+
+        // Movement notifications are throttled, catch what they missed from time to time
+        uint32 interval = sVanillaNaxxramas->livingPoisonCheckInterval;
+        if (!interval)
+            return;
+
+        _checkTimer += diff;
+        if (_checkTimer < interval)
+            return;
+
+        _checkTimer = 0;
+        if (!_instance)
+            return;
+
+        _instance->GetRoster().ForEachActive([this](Player* player)
+        {
+            if (!_exploded && CanExplodeOn(player))
+                Explode();
+        });
+    }
+
+private:
+    // Players only, pets and guardians walk through. Both paths use this rule.
+    bool CanExplodeOn(Unit* who) const
+    {
+        return who->IsPlayer() && who->IsAlive() && me->IsWithinDistInMap(who, LivingPoisonExplodeRange) && me->IsValidAttackTarget(who);
+    }
+
+    void Explode()
+    {
+        _exploded = true;
+        me->CastSpell(me, SPELL_EXPLODE, true);
+    }
+
+    NaxxramasInstanceScript* _instance;
+    uint32 _checkTimer{};
+    bool _exploded{};
 };
 
 class npc_naxxramas_trigger : public NullCreatureAI
 {
 public:
-    npc_naxxramas_trigger(Creature* c) : NullCreatureAI(c) { }
+    npc_naxxramas_trigger(Creature* c) : NullCreatureAI(c), _instance(GetNaxxramasInstance(c->GetInstanceScript())) { }
 
     void Reset() override
     {
@@ -806,6 +1196,10 @@ public:
 
     void UpdateAI(uint32 diff) override
     {
+        // The spawn timer is frozen while the wing is dormant
+        if (_instance && !_instance->IsWingOccupied(NAXX_WING_CONSTRUCT_QUARTER))
+            return;
+
         _events.Update(diff);
         switch (_events.ExecuteEvent())
         {
@@ -828,6 +1222,7 @@ public:
 
 private:
     EventMap _events;
+    NaxxramasInstanceScript* _instance;
 };
 
 class at_naxxramas_hub_portal : public AreaTriggerScript
@@ -855,6 +1250,115 @@ public:
     }
 };
 
+static bool IsResistanceModifier(SpellInfo const* spellInfo)
+{
+    return spellInfo->HasAura(SPELL_AURA_MOD_RESISTANCE) || spellInfo->HasAura(SPELL_AURA_MOD_BASE_RESISTANCE) ||
+        spellInfo->HasAura(SPELL_AURA_MOD_RESISTANCE_PCT) || spellInfo->HasAura(SPELL_AURA_MOD_BASE_RESISTANCE_PCT) ||
+        spellInfo->HasAura(SPELL_AURA_MOD_RESISTANCE_EXCLUSIVE);
+}
+
+static void NotifyResistanceChange(Unit* unit)
+{
+    if (!unit->IsPlayer() || unit->GetMapId() != NaxxramasMapId)
+        return;
+
+    if (NaxxramasInstanceScript* instance = GetNaxxramasInstance(unit->GetInstanceScript()))
+        instance->OnPlayerResistanceChange(unit->ToPlayer());
+}
+
+class naxxramas_roster_unitscript : public UnitScript
+{
+public:
+    naxxramas_roster_unitscript() : UnitScript("naxxramas_roster_unitscript") { }
+
+    void OnAuraApply(Unit* unit, Aura* aura) override
+    {
+        if (IsResistanceModifier(aura->GetSpellInfo()))
+            NotifyResistanceChange(unit);
+    }
+
+    // Removing a debuff that lowers resistances raises them
+    void OnAuraRemove(Unit* unit, AuraApplication* aurApp, AuraRemoveMode /*mode*/) override
+    {
+        if (IsResistanceModifier(aurApp->GetBase()->GetSpellInfo()))
+            NotifyResistanceChange(unit);
+    }
+};
+
+class naxxramas_roster_playerscript : public PlayerScript
+{
+public:
+    naxxramas_roster_playerscript() : PlayerScript("naxxramas_roster_playerscript") { }
+
+    void OnPlayerEquip(Player* player, Item* /*item*/, uint8 /*bag*/, uint8 /*slot*/, bool /*update*/) override
+    {
+        NotifyResistanceChange(player);
+    }
+
+    void OnPlayerUnequip(Player* player, Item* /*item*/) override
+    {
+        NotifyResistanceChange(player);
+    }
+
+    // Swapping two equipped items moves them without unequipping either
+    void OnPlayerAfterSetVisibleItemSlot(Player* player, uint8 /*slot*/, Item* /*item*/) override
+    {
+        NotifyResistanceChange(player);
+    }
+
+    void OnPlayerLearnTalents(Player* player, uint32 /*talentId*/, uint32 /*talentRank*/, uint32 /*spellId*/) override
+    {
+        NotifyResistanceChange(player);
+    }
+
+    void OnPlayerTalentsReset(Player* player, bool /*noCost*/) override
+    {
+        NotifyResistanceChange(player);
+    }
+
+    void OnPlayerAfterSpecSlotChanged(Player* player, uint8 /*newSlot*/) override
+    {
+        NotifyResistanceChange(player);
+    }
+
+    // Casting a resistance buff on a player that already has it adds a stack or refreshes the
+    // aura with the caster's current amount, neither of which applies the aura again. A dispel
+    // takes stacks off a debuff that lowers resistances the same way.
+    void OnPlayerSpellCast(Player* player, Spell* spell, bool /*skipCheck*/) override
+    {
+        if (player->GetMapId() != NaxxramasMapId)
+            return;
+
+        SpellInfo const* spellInfo = spell->GetSpellInfo();
+        if (!IsResistanceModifier(spellInfo) && !spellInfo->HasEffect(SPELL_EFFECT_DISPEL))
+            return;
+
+        if (Unit* target = spell->m_targets.GetUnitTarget())
+        {
+            NotifyResistanceChange(target);
+            return;
+        }
+
+        // Group buffs have no unit target, they reach the caster's group
+        Group* group = player->GetGroup();
+        if (!group)
+            return NotifyResistanceChange(player);
+
+        for (GroupReference* itr = group->GetFirstMember(); itr; itr = itr->next())
+            if (Player* member = itr->GetSource())
+                NotifyResistanceChange(member);
+    }
+
+    void OnPlayerResurrect(Player* player, float /*restorePercent*/, bool /*applySickness*/) override
+    {
+        if (player->GetMapId() != NaxxramasMapId)
+            return;
+
+        if (NaxxramasInstanceScript* instance = GetNaxxramasInstance(player->GetInstanceScript()))
+            instance->OnPlayerResurrect(player);
+    }
+};
+
 class OnyNaxxLogoutTeleport : public PlayerScript
 {
 public:
@@ -904,4 +1408,6 @@ void AddSC_instance_naxxramas()
     RegisterNaxxramasCreatureAI(npc_naxxramas_trigger);
     new at_naxxramas_hub_portal();
     new OnyNaxxLogoutTeleport();
+    new naxxramas_roster_playerscript();
+    new naxxramas_roster_unitscript();
 }
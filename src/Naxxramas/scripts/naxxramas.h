@@ -19,6 +19,7 @@
 #define DEF_NAXXRAMAS_H
 
 #include "naxxramas_40.h"
+#include <array>
 
 #define DataHeader "NAX"
 
@@ -59,6 +60,9 @@ enum NaxxramasData
     DATA_SAPPHIRON_BOSS             = 110,
     DATA_KELTHUZAD_BOSS             = 111,
     DATA_LICH_KING_BOSS             = 112,
+    DATA_HEIGAN_BOSS                = 113,
+    DATA_TESLA_COIL_STALAGG         = 113,
+    DATA_TESLA_COIL_FEUGEN          = 114,
 
     DATA_LOATHEB_PORTAL             = 200,
     DATA_MAEXXNA_PORTAL             = 201,
@@ -72,6 +76,8 @@ enum NaxxramasData
     DATA_KELTHUZAD_PORTAL_2         = 209,
     DATA_KELTHUZAD_PORTAL_3         = 210,
     DATA_KELTHUZAD_PORTAL_4         = 211,
+    DATA_TESLA_COIL_LEFT            = 212,
+    DATA_TESLA_COIL_RIGHT           = 213,
 
     DATA_HEIGAN_ERUPTION            = 300,
     DATA_DANCE_FAIL                 = 301,
@@ -111,6 +117,9 @@ enum NaxxramasGameObject
     GO_HORSEMEN_GATE                = 181119,
     GO_SAPPHIRON_GATE               = 181225,
 
+    GO_TESLA_COIL_LEFT              = 181478,
+    GO_TESLA_COIL_RIGHT             = 181477,
+
     GO_HORSEMEN_CHEST_10            = 181366,
     GO_HORSEMEN_CHEST_25            = 193426,
 
@@ -163,6 +172,7 @@ enum NaxxramasCreatureId
     NPC_THADDIUS                    = 15928,
     NPC_STALAGG                     = 15929,
     NPC_FEUGEN                      = 15930,
+    NPC_TESLA_COIL                  = 16218,
 
     // Razuvious
     NPC_RAZUVIOUS                   = 16061,
@@ -170,6 +180,9 @@ enum NaxxramasCreatureId
     // Gothik
     NPC_GOTHIK                      = 16060,
 
+    // Heigan
+    NPC_HEIGAN                      = 15936,
+
     // Four horseman
     NPC_BARON_RIVENDARE             = 30549,
     NPC_SIR_ZELIEK                  = 16063,
@@ -291,7 +304,10 @@ enum NaxxramasEvent
     EVENT_KELTHUZAD_LICH_KING_TALK3           = 16,
     EVENT_KELTHUZAD_LICH_KING_TALK4           = 17,
     EVENT_KELTHUZAD_LICH_KING_TALK5           = 18,
-    EVENT_KELTHUZAD_LICH_KING_TALK6           = 19
+    EVENT_KELTHUZAD_LICH_KING_TALK6           = 19,
+
+    EVENT_ENCOUNTER_PROFILE_REPORT            = 20,
+    EVENT_ROSTER_REFRESH                      = 21
 };
 
 enum NaxxramasMisc
@@ -306,9 +322,28 @@ enum NaxxramasMisc
     SOUND_SCREAM                    = 8873
 };
 
+enum NaxxramasWing : uint8
+{
+    NAXX_WING_CONSTRUCT_QUARTER     = 0, // the only wing with ambient scripts
+    MAX_NAXX_WINGS
+};
+
 static constexpr uint32 NaxxramasMapId            = 533;
 static constexpr uint8 HeiganEruptSectionCount    = 4;
+static constexpr uint8 HeiganEruptionsPerSection  = 64; // reserved once, the room holds fewer than that per section
+
+// Heigan's room, the tunnel to Loatheb starts right behind HeiganRoomMinY
+static constexpr float HeiganRoomMinX             = 2723.0f;
+static constexpr float HeiganRoomMaxX             = 2826.0f;
+static constexpr float HeiganRoomMinY             = -3736.0f;
+static constexpr float HeiganRoomMaxY             = -3641.0f;
+
+// Safe section of every eruption, the dance sweeps from the entrance to the back of the room and returns
+static constexpr std::array<uint8, 6> HeiganEruptSchedule { 3, 2, 1, 0, 1, 2 };
 static constexpr uint8 HorsemanCount              = 4;
+static constexpr float GothikGateY                = -3360.78f; // the living side is below it
+static constexpr float GothikPlatformZ            = 280.0f;    // Gothik's platform and its soul triggers are above it
+static constexpr float TeslaCoilSplitX            = 3507.0f; // Feugen's coil is east of it, Stalagg's west
 static constexpr uint8 AbominationKillCountReq    = 18;
 static constexpr uint8 TheDedicatedFew10PlayerReq = 9;
 static constexpr uint8 TheDedicatedFew25PlayerReq = 21;
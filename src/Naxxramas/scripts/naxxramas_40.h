@@ -137,6 +137,7 @@ enum NX40NPCs
     NPC_SLUDGE_BELCHER_40              = 351029,
 
     // Heigan
+    NPC_HEIGAN_40                      = 351005,
     NPC_ROTTING_MAGGOT_40              = 351034,
     NPC_DISEASED_MAGGOT_40             = 351033,
     NPC_EYE_STALK_40                   = 351090,
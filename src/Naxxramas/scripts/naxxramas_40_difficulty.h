@@ -0,0 +1,83 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DEF_NAXXRAMAS_40_DIFFICULTY_H
+#define DEF_NAXXRAMAS_40_DIFFICULTY_H
+
+#include "Creature.h"
+#include "naxxramas_40_instance.h"
+
+// Difficulty parameter of an AI that reads the difficulty from its map, as ScriptedAI does
+static constexpr Difficulty NaxxRuntimeDifficulty = Difficulty(MAX_DIFFICULTY);
+
+// Difficulty dependent values of a boss AI compiled for difficulty D. Every difficulty but
+// NaxxRuntimeDifficulty is folded at compile time, the other branches are not even instantiated.
+template<Difficulty D>
+struct NaxxDifficulty
+{
+    static constexpr bool IsRuntime = D == NaxxRuntimeDifficulty;
+    static constexpr bool Is40 = D == RAID_DIFFICULTY_10MAN_HEROIC;
+
+    // Same as ScriptedAI::RAID_MODE
+    template<typename T>
+    static T RaidMode(Creature const* me, T normal10, T normal25, T heroic10, T heroic25)
+    {
+        if constexpr (D == RAID_DIFFICULTY_10MAN_NORMAL)
+            return normal10;
+        else if constexpr (D == RAID_DIFFICULTY_25MAN_NORMAL)
+            return normal25;
+        else if constexpr (D == RAID_DIFFICULTY_10MAN_HEROIC)
+            return heroic10;
+        else if constexpr (D == RAID_DIFFICULTY_25MAN_HEROIC)
+            return heroic25;
+        else
+        {
+            if (me->GetMap()->IsRaid())
+            {
+                switch (me->GetMap()->GetDifficulty())
+                {
+                    case RAID_DIFFICULTY_25MAN_NORMAL:
+                        return normal25;
+                    case RAID_DIFFICULTY_10MAN_HEROIC:
+                        return heroic10;
+                    case RAID_DIFFICULTY_25MAN_HEROIC:
+                        return heroic25;
+                    default:
+                        break;
+                }
+            }
+
+            return normal10;
+        }
+    }
+
+    // Same as ScriptedAI::Is25ManRaid
+    static bool Is25Man(Creature const* me) { return RaidMode(me, false, true, false, true); }
+};
+
+// Boss AIs templated on their difficulty are created through this instead of GetNaxxramasAI:
+// Naxx40 instances get the AI compiled for RAID_DIFFICULTY_10MAN_HEROIC, others the runtime one.
+template<template<Difficulty> class AI, typename T>
+inline CreatureAI* GetNaxxramasDifficultyAI(T* obj)
+{
+    if (IsNaxx40(obj))
+        return GetNaxxramasAI<AI<RAID_DIFFICULTY_10MAN_HEROIC>>(obj);
+
+    return GetNaxxramasAI<AI<NaxxRuntimeDifficulty>>(obj);
+}
+
+#endif
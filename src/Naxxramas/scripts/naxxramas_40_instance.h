@@ -0,0 +1,125 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DEF_NAXXRAMAS_40_INSTANCE_H
+#define DEF_NAXXRAMAS_40_INSTANCE_H
+
+#include "InstanceScript.h"
+#include "Map.h"
+#include "naxxramas.h"
+#include "naxxramas_40_polarity.h"
+#include "naxxramas_40_profiler.h"
+#include "naxxramas_40_roster.h"
+#include "naxxramas_40_scaling.h"
+#include "naxxramas_40_summon_pool.h"
+#include <array>
+#include <memory>
+#include <vector>
+
+// Difficulty of an instance, resolved once when it is created. Damage values are not part of
+// it, they are realm wide and read from sNaxx40Tuning.
+struct Naxx40Traits
+{
+    bool is40;
+    Difficulty difficulty;
+};
+
+// Shared state of instance_naxxramas that boss and spell scripts need direct access to
+class NaxxramasInstanceScript : public InstanceScript
+{
+public:
+    explicit NaxxramasInstanceScript(Map* map) : InstanceScript(map),
+        _traits{ map->GetDifficulty() == RAID_DIFFICULTY_10MAN_HEROIC, map->GetDifficulty() } { }
+
+    Naxx40Traits const& GetTraits() const { return _traits; }
+
+    // nullptr unless VanillaNaxxramas.Naxxramas.EncounterProfiling is enabled
+    EncounterProfiler* GetEncounterProfiler();
+
+    // nullptr unless VanillaNaxxramas.Naxxramas.SummonPooling is enabled
+    SummonPool* GetSummonPool();
+
+    RaidRoster const& GetRoster() const { return _roster; }
+    void OnPlayerResurrect(Player* player) { _roster.SetAlive(player, true); }
+
+    PolarityGrid& GetPolarityGrid() { return _polarityGrid; }
+
+    RaidSizeScaling& GetRaidSizeScaling() { return _raidSizeScaling; }
+    RaidSizeScaling const& GetRaidSizeScaling() const { return _raidSizeScaling; }
+
+    // Ground triggers of Gothik's room on either side of the gate, collected as the room loads
+    std::vector<ObjectGuid> const& GetGothikTriggers(bool liveSide) const { return _gothikTriggers[liveSide]; }
+
+    // A wing is dormant while no player is near it, its ambient scripts do nothing meanwhile
+    bool IsWingOccupied(uint8 wing) const { return _occupiedWings & (1 << wing); }
+
+    // An aura, item, talent or spell that can modify the player's resistances changed
+    virtual void OnPlayerResistanceChange(Player* /*player*/) { }
+
+protected:
+    Naxx40Traits const _traits;
+    std::unique_ptr<EncounterProfiler> _encounterProfiler;
+    SummonPool _summonPool;
+    RaidRoster _roster;
+    PolarityGrid _polarityGrid;
+    RaidSizeScaling _raidSizeScaling;
+    std::array<std::vector<ObjectGuid>, 2> _gothikTriggers; // dead side first
+    uint8 _occupiedWings{ 0xFF };
+};
+
+inline NaxxramasInstanceScript* GetNaxxramasInstance(InstanceScript* instance)
+{
+    return dynamic_cast<NaxxramasInstanceScript*>(instance);
+}
+
+// Traits of the Naxxramas instance obj is in, not 40 anywhere else. Called on every spell hit and tick,
+// so the map id is compared first and the instance script is read from the object's own map.
+inline Naxx40Traits const& GetNaxx40Traits(WorldObject const* obj)
+{
+    static Naxx40Traits const none{ false, REGULAR_DIFFICULTY };
+    if (obj->GetMapId() != NaxxramasMapId || !obj->IsInWorld())
+        return none;
+
+    InstanceMap* map = obj->GetMap()->ToInstanceMap();
+    NaxxramasInstanceScript* naxxramas = map ? GetNaxxramasInstance(map->GetInstanceScript()) : nullptr;
+    return naxxramas ? naxxramas->GetTraits() : none;
+}
+
+inline bool IsNaxx40(WorldObject const* obj)
+{
+    return GetNaxx40Traits(obj).is40;
+}
+
+// Roster of the instance the unit is in, empty outside of Naxxramas
+inline RaidRoster const& GetNaxxramasRoster(InstanceScript* instance)
+{
+    static RaidRoster const empty;
+    NaxxramasInstanceScript* naxxramas = GetNaxxramasInstance(instance);
+    return naxxramas ? naxxramas->GetRoster() : empty;
+}
+
+// Encounter adds that can be recycled go through these, they fall back to plain
+// SummonCreature / corpse handling when pooling is disabled.
+// Release returns true when the pool took over the corpse.
+Creature* SummonNaxxramasCreature(Creature* summoner, uint32 entry, Position const& pos);
+bool ReleaseNaxxramasCreature(Creature* summon);
+void DespawnNaxxramasPool(Creature* summoner, uint32 entry);
+
+// Scales a creature that was respawned to the locked raid size, nothing when the size is not locked
+void ApplyNaxxramasRaidSizeScaling(Creature* creature);
+
+#endif
@@ -0,0 +1,161 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "naxxramas_40_polarity.h"
+#include "Unit.h"
+#include <algorithm>
+
+uint8 PolarityGrid::GetCell(float coord, float origin) const
+{
+    float cell = (coord - origin) / PolarityGridCellSize;
+    return uint8(std::clamp(cell, 0.0f, float(PolarityGridDim - 1)));
+}
+
+void PolarityGrid::Activate(uint32 positiveAura, uint32 negativeAura)
+{
+    _positiveAura = positiveAura;
+    _negativeAura = negativeAura;
+    _active = true;
+    _built = false;
+}
+
+void PolarityGrid::Refresh(RaidRoster const& roster, uint64 pulseKey)
+{
+    if (_built && _pulseKey == pulseKey)
+        return;
+
+    Build(roster);
+    _pulseKey = pulseKey;
+}
+
+void PolarityGrid::Build(RaidRoster const& roster)
+{
+    _unsorted.clear();
+    _originX = 0.0f;
+    _originY = 0.0f;
+    _maxSize = 0.0f;
+
+    for (RaidRosterEntry const& entry : roster.GetEntries())
+    {
+        if (!RaidRoster::IsActive(entry))
+            continue;
+
+        Player* player = entry.player;
+        uint8 sign;
+        if (player->HasAura(_positiveAura))
+            sign = 1;
+        else if (player->HasAura(_negativeAura))
+            sign = 0;
+        else
+            continue;
+
+        Point point{ player, player->GetPositionX(), player->GetPositionY(), player->GetPositionZ(), player->GetObjectSize() };
+        if (_unsorted.empty())
+        {
+            _originX = point.x;
+            _originY = point.y;
+        }
+        else
+        {
+            _originX = std::min(_originX, point.x);
+            _originY = std::min(_originY, point.y);
+        }
+
+        _maxSize = std::max(_maxSize, point.size);
+
+        _unsorted.emplace_back(point, sign);
+    }
+
+    // Counting sort of the points by cell, each cell is then a contiguous range of its layer
+    for (Layer& layer : _layers)
+    {
+        layer.start.fill(0);
+        layer.points.resize(0);
+    }
+
+    for (auto const& [point, sign] : _unsorted)
+        ++_layers[sign].start[GetCell(point.y, _originY) * PolarityGridDim + GetCell(point.x, _originX) + 1];
+
+    for (Layer& layer : _layers)
+    {
+        for (std::size_t i = 1; i < layer.start.size(); ++i)
+            layer.start[i] += layer.start[i - 1];
+
+        layer.points.resize(layer.start.back());
+    }
+
+    std::array<std::array<uint16, PolarityGridDim * PolarityGridDim>, 2> next;
+    for (uint8 sign = 0; sign < 2; ++sign)
+        std::copy_n(_layers[sign].start.begin(), next[sign].size(), next[sign].begin());
+
+    for (auto const& [point, sign] : _unsorted)
+    {
+        uint16 cell = GetCell(point.y, _originY) * PolarityGridDim + GetCell(point.x, _originX);
+        _layers[sign].points[next[sign][cell]++] = point;
+    }
+
+    _built = true;
+}
+
+void PolarityGrid::Clear()
+{
+    for (Layer& layer : _layers)
+        layer.points.clear();
+
+    _unsorted.clear();
+    _active = false;
+    _built = false;
+}
+
+uint32 PolarityGrid::CountNear(Unit const* caster, bool positive, float radius) const
+{
+    Layer const& layer = _layers[positive];
+    if (layer.points.empty())
+        return 0;
+
+    float x = caster->GetPositionX();
+    float y = caster->GetPositionY();
+    float z = caster->GetPositionZ();
+
+    // Players beyond the grid were clamped into its border cells, so were the bounds of the search
+    float reach = radius + _maxSize;
+    uint8 minCellX = GetCell(x - reach, _originX);
+    uint8 maxCellX = GetCell(x + reach, _originX);
+    uint8 minCellY = GetCell(y - reach, _originY);
+    uint8 maxCellY = GetCell(y + reach, _originY);
+
+    uint32 count = 0;
+    for (uint8 cellY = minCellY; cellY <= maxCellY; ++cellY)
+    {
+        uint16 row = cellY * PolarityGridDim;
+        for (uint16 i = layer.start[row + minCellX]; i < layer.start[row + maxCellX + 1]; ++i)
+        {
+            Point const& point = layer.points[i];
+            if (point.unit == caster)
+                continue;
+
+            float dx = point.x - x;
+            float dy = point.y - y;
+            float dz = point.z - z;
+            float range = radius + point.size;
+            if (dx * dx + dy * dy + dz * dz <= range * range)
+                ++count;
+        }
+    }
+
+    return count;
+}
@@ -0,0 +1,79 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DEF_NAXXRAMAS_40_POLARITY_H
+#define DEF_NAXXRAMAS_40_POLARITY_H
+
+#include "Define.h"
+#include "naxxramas_40_roster.h"
+#include <array>
+#include <vector>
+
+class Unit;
+
+static constexpr float PolarityGridCellSize = 10.0f;
+static constexpr uint8 PolarityGridDim      = 16; // cells per side, covers the whole Thaddius platform
+
+// Charged players of the Thaddius encounter in a uniform grid, one layer per charge sign.
+// Thaddius activates it when he engages. The first charge pulse of a map update builds it
+// and the other pulses of that update count the players sharing their sign with a few
+// cell lookups instead of an aura search per target.
+class PolarityGrid
+{
+public:
+    void Activate(uint32 positiveAura, uint32 negativeAura);
+    void Clear();
+
+    // Builds the grid unless it was already built for that pulse key, the game time of the map update
+    void Refresh(RaidRoster const& roster, uint64 pulseKey);
+    void Build(RaidRoster const& roster);
+
+    // Same sign players other than caster within radius of it, as selected by a SRC_AREA_ALLY spell
+    uint32 CountNear(Unit const* caster, bool positive, float radius) const;
+
+    // Thaddius is in his own phase, the charge spells count on the grid
+    bool IsActive() const { return _active; }
+
+private:
+    struct Point
+    {
+        Unit const* unit;
+        float x, y, z;
+        float size;
+    };
+
+    struct Layer
+    {
+        std::array<uint16, PolarityGridDim * PolarityGridDim + 1> start; // first point of each cell in points
+        std::vector<Point> points;
+    };
+
+    uint8 GetCell(float coord, float origin) const;
+
+    std::array<Layer, 2> _layers{}; // indexed by charge sign, positive is 1
+    std::vector<std::pair<Point, uint8>> _unsorted; // reused between builds
+    float _originX{};
+    float _originY{};
+    float _maxSize{};
+    uint64 _pulseKey{};
+    uint32 _positiveAura{};
+    uint32 _negativeAura{};
+    bool _active{};
+    bool _built{};
+};
+
+#endif
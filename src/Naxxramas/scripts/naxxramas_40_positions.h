@@ -0,0 +1,164 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DEF_NAXXRAMAS_40_POSITIONS_H
+#define DEF_NAXXRAMAS_40_POSITIONS_H
+
+#include "Map.h"
+#include "Player.h"
+#include "Random.h"
+#include "naxxramas_40_roster.h"
+#include <array>
+#include <bit>
+
+static constexpr uint8 PlayerSnapshotCapacity = 64; // one bit per player in the masks below
+
+struct NaxxRoomBounds
+{
+    float minX, maxX, minY, maxY;
+};
+
+// Positions of the players of a map in structure of arrays layout. The classification
+// methods run a fixed number of iterations over plain float arrays without branches,
+// which the compiler turns into SIMD compares, and return one bit per player.
+class PlayerPositionSnapshot
+{
+public:
+    explicit PlayerPositionSnapshot(Map const* map)
+    {
+        for (auto const& itr : map->GetPlayers())
+            if (Player* player = itr.GetSource())
+                Add(player, player->IsAlive());
+
+        _usedMask = _count == PlayerSnapshotCapacity ? ~uint64(0) : (uint64(1) << _count) - 1;
+    }
+
+    // Bit i of the masks is the roster entry i
+    explicit PlayerPositionSnapshot(RaidRoster const& roster) { Refresh(roster); }
+    PlayerPositionSnapshot() = default;
+
+    // Retakes the positions of the roster, for a snapshot kept across updates
+    void Refresh(RaidRoster const& roster)
+    {
+        _count = 0;
+        _aliveMask = 0;
+        _gameMasterMask = 0;
+        for (RaidRosterEntry const& entry : roster.GetEntries())
+            Add(entry.player, entry.alive);
+
+        _usedMask = _count == PlayerSnapshotCapacity ? ~uint64(0) : (uint64(1) << _count) - 1;
+    }
+
+    uint64 InsideMask(NaxxRoomBounds const& bounds) const
+    {
+        std::array<uint8, PlayerSnapshotCapacity> inside;
+        for (uint8 i = 0; i < PlayerSnapshotCapacity; ++i)
+            inside[i] = uint8(_x[i] >= bounds.minX) & uint8(_x[i] <= bounds.maxX) & uint8(_y[i] >= bounds.minY) & uint8(_y[i] <= bounds.maxY);
+
+        return Pack(inside) & _usedMask;
+    }
+
+    // Players on the lower side of the plane y = planeY
+    uint64 BelowYMask(float planeY) const
+    {
+        std::array<uint8, PlayerSnapshotCapacity> below;
+        for (uint8 i = 0; i < PlayerSnapshotCapacity; ++i)
+            below[i] = uint8(_y[i] <= planeY);
+
+        return Pack(below) & _usedMask;
+    }
+
+    // Players within dist yards of center, in 3D
+    uint64 WithinDistMask(Position const& center, float dist) const
+    {
+        float cx = center.GetPositionX(), cy = center.GetPositionY(), cz = center.GetPositionZ();
+        float distSq = dist * dist;
+        std::array<uint8, PlayerSnapshotCapacity> within;
+        for (uint8 i = 0; i < PlayerSnapshotCapacity; ++i)
+        {
+            float dx = _x[i] - cx, dy = _y[i] - cy, dz = _z[i] - cz;
+            within[i] = uint8(dx * dx + dy * dy + dz * dz <= distSq);
+        }
+
+        return Pack(within) & _usedMask;
+    }
+
+    uint64 AliveMask() const { return _aliveMask; }
+    uint64 DeadMask() const { return _usedMask & ~_aliveMask; }
+    uint64 GameMasterMask() const { return _gameMasterMask; }
+
+    Player* GetPlayer(uint8 index) const { return _players[index]; }
+
+    // Index of a random set bit of mask, PlayerSnapshotCapacity when there is none
+    static uint8 SelectRandomIndex(uint64 mask)
+    {
+        if (!mask)
+            return PlayerSnapshotCapacity;
+
+        for (uint32 skip = urand(0, std::popcount(mask) - 1); skip; --skip)
+            mask &= mask - 1;
+
+        return std::countr_zero(mask);
+    }
+
+    template<typename Fn>
+    void ForEach(uint64 mask, Fn&& fn) const
+    {
+        while (mask)
+        {
+            fn(_players[std::countr_zero(mask)]);
+            mask &= mask - 1;
+        }
+    }
+
+private:
+    void Add(Player* player, bool alive)
+    {
+        if (_count == PlayerSnapshotCapacity)
+            return;
+
+        _players[_count] = player;
+        _x[_count] = player->GetPositionX();
+        _y[_count] = player->GetPositionY();
+        _z[_count] = player->GetPositionZ();
+        if (alive)
+            _aliveMask |= uint64(1) << _count;
+        if (player->IsGameMaster())
+            _gameMasterMask |= uint64(1) << _count;
+        ++_count;
+    }
+
+    static uint64 Pack(std::array<uint8, PlayerSnapshotCapacity> const& flags)
+    {
+        uint64 mask = 0;
+        for (uint8 i = 0; i < PlayerSnapshotCapacity; ++i)
+            mask |= uint64(flags[i]) << i;
+
+        return mask;
+    }
+
+    alignas(32) std::array<float, PlayerSnapshotCapacity> _x{};
+    alignas(32) std::array<float, PlayerSnapshotCapacity> _y{};
+    alignas(32) std::array<float, PlayerSnapshotCapacity> _z{};
+    std::array<Player*, PlayerSnapshotCapacity> _players{};
+    uint64 _aliveMask{};
+    uint64 _gameMasterMask{};
+    uint64 _usedMask{};
+    uint8 _count{};
+};
+
+#endif
@@ -0,0 +1,267 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "naxxramas_40_profiler.h"
+#include "VanillaNaxxramas.h"
+#include "naxxramas.h"
+#include "naxxramas_40_instance.h"
+#include <algorithm>
+#include <span>
+
+static_assert(EncounterProfiledBosses == MAX_ENCOUNTERS, "EncounterProfiledBosses must match NaxxramasEncouter");
+
+static char const* const NaxxramasBossNames[MAX_ENCOUNTERS]
+{
+    "Patchwerk",
+    "Grobbulus",
+    "Gluth",
+    "Noth",
+    "Heigan",
+    "Loatheb",
+    "Anub'Rekhan",
+    "Faerlina",
+    "Maexxna",
+    "Thaddius",
+    "Razuvious",
+    "Gothik",
+    "Four Horsemen",
+    "Sapphiron",
+    "Kel'Thuzad"
+};
+
+// Names of the event ids of each boss script, index 0 holds the ticks without an event.
+// Keep them in the order of the Events enum of the boss script.
+static char const* const PatchwerkEventNames[] { "Idle", "Health Check", "Hateful Strike", "Slime Bolt", "Berserk" };
+static char const* const GrobbulusEventNames[] { "Idle", "Berserk", "Poison Cloud", "Slime Spray", "Mutating Injection" };
+static char const* const GluthEventNames[] { "Idle", "Mortal Wound", "Enrage", "Decimate", "Berserk", "Summon Zombie", "Can Eat Zombie", "Terrifying Roar" };
+static char const* const NothEventNames[] { "Idle", "Curse", "Cripple", "Summon Warrior Announce", "Move To Balcony", "Blink", "Move To Ground",
+    "Summon Warrior", "Balcony Summon Announce", "Balcony Summon" };
+static char const* const HeiganEventNames[] { "Idle", "Disruption", "Decrepit Fever", "Erupt Section", "Switch Phase", "Safety Dance", "Plague Cloud",
+    "Teleport Player" };
+static char const* const LoathebEventNames[] { "Idle", "Corrupted Mind", "Poison Shock", "Inevitable Doom", "Remove Curse", "Summon Spore",
+    "Necrotic Aura Fading", "Necrotic Aura Removed" };
+static char const* const MaexxnaEventNames[] { "Idle", "Web Spray", "Poison Shock", "Necrotic Poison", "Web Wrap", "Health Check", "Summon Spiderlings",
+    "Web Wrap Stun" };
+static char const* const ThaddiusEventNames[] { "Idle", "Power Surge", "Magnetic Pull", "Check Distance", "Static Field", "Init", "Enter Combat",
+    "Chain Lightning", "Berserk", "Polarity Shift", "Allow Ball Lightning" };
+static char const* const RazuviousEventNames[] { "Idle", "Unbalancing Strike", "Disrupting Shout", "Jagged Knife" };
+static char const* const GothikEventNames[] { "Idle", "Summon Adds", "Harvest Soul", "Shadow Bolt", "Teleport", "Check Health", "Check Players",
+    "Death Plague", "Arcane Explosion", "Shadow Mark", "Whirlwind", "Shadow Bolt Volley", "Drain Life", "Unholy Frenzy", "Stomp", "Intro 2", "Intro 3",
+    "Intro 4" };
+static char const* const HorsemenEventNames[] { "Idle", "Mark", "Primary Spell", "Secondary Spell", "Berserk", "Health Check" };
+static char const* const SapphironEventNames[] { "Idle", "Berserk", "Cleave", "Tail Sweep", "Life Drain", "Blizzard", "Flight Start", "Flight Liftoff",
+    "Icebolt", "Frost Breath", "Frost Explosion", "Flight Start Land", "Land", "Ground" };
+static char const* const KelThuzadEventNames[] { "Idle", "Summon Soldier", "Summon Abomination", "Summon Soul Weaver", "Phase 2", "Frostbolt",
+    "Frostbolt Volley", "Detonate Mana", "Phase 3", "Lich King Say", "Shadow Fissure", "Frost Blast", "Chains", "Summon Guardian", "Floor Change",
+    "Enrage", "Spawn Pool", "Minion Frenzy", "Minion Mortal Wound", "Minion Blood Tap" };
+static char const* const NoEventNames[] { "Idle" };
+
+static std::span<char const* const> const NaxxramasEventNames[MAX_ENCOUNTERS]
+{
+    PatchwerkEventNames,
+    GrobbulusEventNames,
+    GluthEventNames,
+    NothEventNames,
+    HeiganEventNames,
+    LoathebEventNames,
+    NoEventNames, // Anub'Rekhan does not report its events
+    NoEventNames, // Faerlina does not report its events
+    MaexxnaEventNames,
+    ThaddiusEventNames,
+    RazuviousEventNames,
+    GothikEventNames,
+    HorsemenEventNames,
+    SapphironEventNames,
+    KelThuzadEventNames
+};
+
+void EncounterHistogram::Add(uint64 micros)
+{
+    uint8 bucket = 0;
+    while (bucket < EncounterHistogramBuckets - 1 && (uint64(1) << bucket) <= micros)
+        ++bucket;
+
+    ++_buckets[bucket];
+    ++_count;
+    _total += micros;
+    if (micros > _max)
+        _max = micros;
+}
+
+void EncounterHistogram::Merge(EncounterHistogram const& other)
+{
+    for (uint8 bucket = 0; bucket < EncounterHistogramBuckets; ++bucket)
+        _buckets[bucket] += other._buckets[bucket];
+
+    _count += other._count;
+    _total += other._total;
+    _max = std::max(_max, other._max);
+}
+
+void EncounterHistogram::Reset()
+{
+    _buckets.fill(0);
+    _count = 0;
+    _total = 0;
+    _max = 0;
+}
+
+uint64 EncounterHistogram::GetPercentile(float pct) const
+{
+    if (!_count)
+        return 0;
+
+    uint64 rank = uint64(pct * _count);
+    uint64 seen = 0;
+    for (uint8 bucket = 0; bucket < EncounterHistogramBuckets; ++bucket)
+    {
+        seen += _buckets[bucket];
+        if (seen > rank)
+            return std::min(uint64(1) << bucket, _max);
+    }
+
+    return _max;
+}
+
+void EncounterProfiler::Record(uint32 bossId, uint32 eventId, uint64 micros)
+{
+    if (bossId >= EncounterProfiledBosses)
+        return;
+
+    _histograms[bossId][std::min<uint32>(eventId, EncounterProfiledEvents - 1)].Add(micros);
+}
+
+void EncounterProfiler::Reset()
+{
+    for (uint32 bossId = 0; bossId < EncounterProfiledBosses; ++bossId)
+        ResetBoss(bossId);
+}
+
+void EncounterProfiler::ResetBoss(uint32 bossId)
+{
+    if (bossId >= EncounterProfiledBosses)
+        return;
+
+    for (EncounterHistogram& histogram : _histograms[bossId])
+        histogram.Reset();
+
+    _gridSearches[bossId] = 0;
+}
+
+void EncounterProfiler::BeginEncounter(uint32 bossId)
+{
+    if (bossId >= EncounterProfiledBosses)
+        return;
+
+    ResetBoss(bossId);
+    _encounterStart[bossId] = std::chrono::steady_clock::now();
+}
+
+EncounterHistogram EncounterProfiler::GetEncounterTicks(uint32 bossId) const
+{
+    EncounterHistogram ticks;
+    if (bossId >= EncounterProfiledBosses)
+        return ticks;
+
+    for (EncounterHistogram const& histogram : _histograms[bossId])
+        ticks.Merge(histogram);
+
+    return ticks;
+}
+
+std::chrono::seconds EncounterProfiler::GetEncounterDuration(uint32 bossId) const
+{
+    if (bossId >= EncounterProfiledBosses || _encounterStart[bossId] == std::chrono::steady_clock::time_point())
+        return std::chrono::seconds::zero();
+
+    return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - _encounterStart[bossId]);
+}
+
+void EncounterProfiler::RecordGridSearch(uint32 bossId)
+{
+    if (bossId < EncounterProfiledBosses)
+        ++_gridSearches[bossId];
+}
+
+uint32 EncounterProfiler::GetGridSearchesPerMinute(uint32 bossId) const
+{
+    uint32 searches = GetGridSearches(bossId);
+    std::chrono::seconds duration = GetEncounterDuration(bossId);
+    if (duration < std::chrono::minutes(1))
+        return searches;
+
+    return uint32(uint64(searches) * 60 / duration.count());
+}
+
+char const* EncounterProfiler::GetBossName(uint32 bossId)
+{
+    return bossId < MAX_ENCOUNTERS ? NaxxramasBossNames[bossId] : "Unknown";
+}
+
+char const* EncounterProfiler::GetEventName(uint32 bossId, uint32 eventId)
+{
+    if (bossId >= MAX_ENCOUNTERS)
+        return "Unknown";
+
+    if (eventId >= EncounterProfiledEvents - 1)
+        return "Other";
+
+    std::span<char const* const> names = NaxxramasEventNames[bossId];
+    return eventId < names.size() ? names[eventId] : "Unknown";
+}
+
+EncounterProfileScope::EncounterProfileScope(InstanceScript* instance, uint32 bossId) : _profiler(nullptr), _bossId(bossId), _eventId(0)
+{
+    if (!sVanillaNaxxramas->encounterProfiling)
+        return;
+
+    if (NaxxramasInstanceScript* naxxramas = GetNaxxramasInstance(instance))
+        _profiler = naxxramas->GetEncounterProfiler();
+
+    if (_profiler)
+        _start = std::chrono::steady_clock::now();
+}
+
+EncounterProfileScope::~EncounterProfileScope()
+{
+    if (!_profiler)
+        return;
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _start);
+    _profiler->Record(_bossId, _eventId, uint64(elapsed.count()));
+}
+
+void CountEncounterGridSearch(InstanceScript* instance, uint32 bossId)
+{
+    if (!sVanillaNaxxramas->encounterProfiling)
+        return;
+
+    if (NaxxramasInstanceScript* naxxramas = GetNaxxramasInstance(instance))
+        if (EncounterProfiler* profiler = naxxramas->GetEncounterProfiler())
+            profiler->RecordGridSearch(bossId);
+}
+
+EncounterProfiler* NaxxramasInstanceScript::GetEncounterProfiler()
+{
+    if (!sVanillaNaxxramas->encounterProfiling)
+        return nullptr;
+
+    if (!_encounterProfiler)
+        _encounterProfiler = std::make_unique<EncounterProfiler>();
+
+    return _encounterProfiler.get();
+}
@@ -0,0 +1,119 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DEF_NAXXRAMAS_40_PROFILER_H
+#define DEF_NAXXRAMAS_40_PROFILER_H
+
+#include "Define.h"
+#include <array>
+#include <chrono>
+
+class InstanceScript;
+
+static constexpr uint8 EncounterHistogramBuckets = 24; // power of two buckets in microseconds, up to ~16s
+static constexpr uint8 EncounterProfiledEvents   = 32; // event ids above this are folded into the last slot
+static constexpr uint8 EncounterProfiledBosses   = 15; // MAX_ENCOUNTERS
+
+// Latency histogram of a single boss event type
+class EncounterHistogram
+{
+public:
+    void Add(uint64 micros);
+    void Merge(EncounterHistogram const& other);
+    void Reset();
+
+    uint64 GetCount() const { return _count; }
+    uint64 GetTotal() const { return _total; }
+    uint64 GetMax() const { return _max; }
+    uint64 GetMean() const { return _count ? _total / _count : 0; }
+
+    // Upper bound of the bucket holding the given percentile (0.0 - 1.0)
+    uint64 GetPercentile(float pct) const;
+
+private:
+    std::array<uint32, EncounterHistogramBuckets> _buckets{};
+    uint64 _count{};
+    uint64 _total{};
+    uint64 _max{};
+};
+
+// Per instance UpdateAI cost, recorded per boss and per event id.
+// Event id 0 holds the ticks where no event was executed.
+class EncounterProfiler
+{
+public:
+    void Record(uint32 bossId, uint32 eventId, uint64 micros);
+    void Reset();
+    void ResetBoss(uint32 bossId);
+
+    // Clears the boss samples so that they only cover the pull that just started
+    void BeginEncounter(uint32 bossId);
+
+    // All ticks of the boss merged into one histogram, regardless of the executed event
+    EncounterHistogram GetEncounterTicks(uint32 bossId) const;
+    std::chrono::seconds GetEncounterDuration(uint32 bossId) const;
+
+    // Grid searches (FindNearestCreature and alike) done by the boss scripts of the encounter
+    void RecordGridSearch(uint32 bossId);
+    uint32 GetGridSearches(uint32 bossId) const { return bossId < EncounterProfiledBosses ? _gridSearches[bossId] : 0; }
+    uint32 GetGridSearchesPerMinute(uint32 bossId) const;
+
+    EncounterHistogram const& GetHistogram(uint32 bossId, uint32 eventId) const { return _histograms[bossId][eventId]; }
+
+    template<typename Fn>
+    void ForEachRecorded(Fn&& fn) const
+    {
+        for (uint32 bossId = 0; bossId < EncounterProfiledBosses; ++bossId)
+            for (uint32 eventId = 0; eventId < EncounterProfiledEvents; ++eventId)
+                if (_histograms[bossId][eventId].GetCount())
+                    fn(bossId, eventId, _histograms[bossId][eventId]);
+    }
+
+    static char const* GetBossName(uint32 bossId);
+    // Name of an event id of that boss script, "Idle" for the ticks where no event was executed
+    static char const* GetEventName(uint32 bossId, uint32 eventId);
+
+private:
+    std::array<std::array<EncounterHistogram, EncounterProfiledEvents>, EncounterProfiledBosses> _histograms{};
+    std::array<std::chrono::steady_clock::time_point, EncounterProfiledBosses> _encounterStart{};
+    std::array<uint32, EncounterProfiledBosses> _gridSearches{};
+};
+
+// Records a grid search of the encounter, does nothing unless profiling is enabled
+void CountEncounterGridSearch(InstanceScript* instance, uint32 bossId);
+
+// Measures the scope it lives in and records it against the event set through SetEvent.
+// Does nothing unless VanillaNaxxramas.Naxxramas.EncounterProfiling is enabled.
+class EncounterProfileScope
+{
+public:
+    EncounterProfileScope(InstanceScript* instance, uint32 bossId);
+    ~EncounterProfileScope();
+
+    EncounterProfileScope(EncounterProfileScope const&) = delete;
+    EncounterProfileScope& operator=(EncounterProfileScope const&) = delete;
+
+    void SetEvent(uint32 eventId) { _eventId = eventId; }
+
+private:
+    EncounterProfiler* _profiler;
+    uint32 _bossId;
+    uint32 _eventId;
+    std::chrono::steady_clock::time_point _start;
+};
+
+#endif
@@ -0,0 +1,166 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "naxxramas_40_roster.h"
+#include "naxxramas.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+static_assert(NaxxRoomNone == MAX_ENCOUNTERS, "NaxxRoomNone must match NaxxramasEncouter");
+
+struct NaxxRoomArea
+{
+    uint8 bossId;
+    float x, y;
+    float radius;    // circular room when set
+    float halfX, halfY; // rectangular room otherwise
+};
+
+// Same areas the boss scripts use for their own room checks
+static NaxxRoomArea const NaxxRoomAreas[]
+{
+    { BOSS_HEIGAN,    (HeiganRoomMinX + HeiganRoomMaxX) / 2, (HeiganRoomMinY + HeiganRoomMaxY) / 2, 0.0f,   (HeiganRoomMaxX - HeiganRoomMinX) / 2, (HeiganRoomMaxY - HeiganRoomMinY) / 2 },
+    { BOSS_GOTHIK,    2692.5f, -3360.0f,   0.0f,   74.5f, 75.0f },
+    { BOSS_NOTH,      2684.8f, -3502.5f,   80.0f,  0.0f,  0.0f  },
+    { BOSS_MAEXXNA,   3486.6f, -3890.6f,   100.0f, 0.0f,  0.0f  },
+    { BOSS_HORSEMAN,  2535.1f, -2968.7f,   100.0f, 0.0f,  0.0f  },
+    { BOSS_SAPPHIRON, 3523.5f, -5235.3f,   100.0f, 0.0f,  0.0f  }
+};
+
+uint8 RaidRoster::GetRoom(Position const& pos)
+{
+    for (NaxxRoomArea const& area : NaxxRoomAreas)
+    {
+        float dx = pos.GetPositionX() - area.x;
+        float dy = pos.GetPositionY() - area.y;
+        if (area.radius > 0.0f)
+        {
+            if (dx * dx + dy * dy <= area.radius * area.radius)
+                return area.bossId;
+        }
+        else if (std::fabs(dx) <= area.halfX && std::fabs(dy) <= area.halfY)
+            return area.bossId;
+    }
+
+    return NaxxRoomNone;
+}
+
+void RaidRoster::Add(Player* player)
+{
+    if (RaidRosterEntry* entry = Find(player))
+    {
+        entry->player = player;
+        entry->alive = player->IsAlive();
+        return;
+    }
+
+    _entries.push_back({ player, player->GetGUID(), player->getClass(), player->getPowerType(), player->IsAlive(), GetRoom(*player), false, AssignSlot(player->GetGUID()) });
+}
+
+uint8 RaidRoster::AssignSlot(ObjectGuid guid)
+{
+    // Slots are owned by a single guid, a remembered slot is never in use by someone else
+    auto itr = _slots.find(guid);
+    if (itr != _slots.end())
+    {
+        _usedSlots |= uint64(1) << itr->second;
+        return itr->second;
+    }
+
+    if (!~_usedSlots)
+        return RaidRosterSlotNone;
+
+    // A slot nobody had yet, else the slot of a player who left
+    uint64 remembered = 0;
+    for (auto const& [owner, slot] : _slots)
+        remembered |= uint64(1) << slot;
+
+    uint64 free = ~_usedSlots & ~remembered ? ~_usedSlots & ~remembered : ~_usedSlots;
+    uint8 slot = std::countr_zero(free);
+
+    std::erase_if(_slots, [slot](auto const& pair) { return pair.second == slot; });
+    _slots[guid] = slot;
+    _usedSlots |= uint64(1) << slot;
+    return slot;
+}
+
+uint8 RaidRoster::GetSlot(ObjectGuid guid) const
+{
+    auto itr = _slots.find(guid);
+    if (itr == _slots.end() || !(_usedSlots & (uint64(1) << itr->second)))
+        return RaidRosterSlotNone;
+
+    return itr->second;
+}
+
+void RaidRoster::Remove(Player* player)
+{
+    auto itr = std::find_if(_entries.begin(), _entries.end(), [player](RaidRosterEntry const& entry) { return entry.player == player; });
+    if (itr == _entries.end())
+        return;
+
+    if (itr->slot != RaidRosterSlotNone)
+        _usedSlots &= ~(uint64(1) << itr->slot);
+
+    *itr = _entries.back();
+    _entries.pop_back();
+}
+
+void RaidRoster::SetAlive(Player* player, bool alive)
+{
+    if (RaidRosterEntry* entry = Find(player))
+        entry->alive = alive;
+}
+
+void RaidRoster::MarkStatsDirty(Player* player)
+{
+    if (RaidRosterEntry* entry = Find(player))
+    {
+        entry->statsDirty = true;
+        _statsDirty = true;
+    }
+}
+
+void RaidRoster::MarkAllStatsDirty()
+{
+    for (RaidRosterEntry& entry : _entries)
+        entry.statsDirty = true;
+
+    _statsDirty = !_entries.empty();
+}
+
+void RaidRoster::Refresh()
+{
+    for (RaidRosterEntry& entry : _entries)
+    {
+        entry.powerType = entry.player->getPowerType();
+        entry.room = GetRoom(*entry.player);
+    }
+}
+
+RaidRosterEntry const* RaidRoster::Find(ObjectGuid guid) const
+{
+    auto itr = std::find_if(_entries.begin(), _entries.end(), [guid](RaidRosterEntry const& entry) { return entry.guid == guid; });
+    return itr != _entries.end() ? &*itr : nullptr;
+}
+
+RaidRosterEntry* RaidRoster::Find(Player* player)
+{
+    auto itr = std::find_if(_entries.begin(), _entries.end(), [player](RaidRosterEntry const& entry) { return entry.player == player; });
+    return itr != _entries.end() ? &*itr : nullptr;
+}
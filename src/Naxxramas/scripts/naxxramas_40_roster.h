@@ -0,0 +1,152 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DEF_NAXXRAMAS_40_ROSTER_H
+#define DEF_NAXXRAMAS_40_ROSTER_H
+
+#include "ObjectGuid.h"
+#include "Player.h"
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+static constexpr uint8 RaidRosterReserve = 40;
+static constexpr uint8 NaxxRoomNone      = 15; // MAX_ENCOUNTERS, rooms are identified by their boss id
+static constexpr uint8 RaidRosterSlots    = 64; // one bit per slot in RaidMemberSet
+static constexpr uint8 RaidRosterSlotNone = RaidRosterSlots;
+
+struct RaidRosterEntry
+{
+    Player* player;
+    ObjectGuid guid;
+    uint8 classId;
+    Powers powerType;
+    bool alive;
+    uint8 room; // boss id of the room the player was in at the last refresh, NaxxRoomNone elsewhere
+    bool statsDirty; // an aura or item that can change resistances was applied since the last check
+    uint8 slot; // kept while the player is inside, given back to the same player when they return
+};
+
+// Players currently inside the instance, kept up to date by instance_naxxramas from the
+// enter/leave/death/resurrect hooks so that boss scripts do not walk Map::GetPlayers().
+// Entries are only valid until the next hook, do not keep pointers to them.
+class RaidRoster
+{
+public:
+    RaidRoster() { _entries.reserve(RaidRosterReserve); }
+
+    void Add(Player* player);
+    void Remove(Player* player);
+    void SetAlive(Player* player, bool alive);
+    void MarkStatsDirty(Player* player);
+    void MarkAllStatsDirty();
+    bool HasStatsDirty() const { return _statsDirty; }
+
+    // Calls fn for every entry marked dirty and clears the marks
+    template<typename Fn>
+    void ConsumeStatsDirty(Fn&& fn)
+    {
+        for (RaidRosterEntry& entry : _entries)
+        {
+            if (!entry.statsDirty)
+                continue;
+
+            entry.statsDirty = false;
+            fn(entry.player);
+        }
+
+        _statsDirty = false;
+    }
+
+    // Refreshes power type and room of every entry
+    void Refresh();
+
+    RaidRosterEntry const* Find(ObjectGuid guid) const;
+    // Slot of a player inside the instance, RaidRosterSlotNone otherwise
+    uint8 GetSlot(ObjectGuid guid) const;
+    std::vector<RaidRosterEntry> const& GetEntries() const { return _entries; }
+    bool IsEmpty() const { return _entries.empty(); }
+
+    // Alive players, game masters are checked live since toggling .gm has no hook
+    static bool IsActive(RaidRosterEntry const& entry) { return entry.alive && !entry.player->IsGameMaster(); }
+
+    template<typename Fn>
+    void ForEachActive(Fn&& fn) const
+    {
+        for (RaidRosterEntry const& entry : _entries)
+            if (IsActive(entry))
+                fn(entry.player);
+    }
+
+    static uint8 GetRoom(Position const& pos);
+
+private:
+    RaidRosterEntry* Find(Player* player);
+    uint8 AssignSlot(ObjectGuid guid);
+
+    std::vector<RaidRosterEntry> _entries;
+    std::unordered_map<ObjectGuid, uint8> _slots; // also remembers the slot of players who left
+    uint64 _usedSlots{};
+    bool _statsDirty{};
+};
+
+// Players an encounter has already picked during a phase, one bit per roster slot.
+// Given a roster entry, membership is a bit test and clearing the phase a single store.
+// Players without a slot are kept by guid so that they are never picked twice either.
+class RaidMemberSet
+{
+public:
+    explicit RaidMemberSet(RaidRoster const& roster) : _roster(&roster) { }
+
+    void Insert(RaidRosterEntry const& entry) { Insert(entry.slot, entry.guid); }
+    bool Contains(RaidRosterEntry const& entry) const { return Contains(entry.slot, entry.guid); }
+
+    // Resolves the slot from the roster, prefer the entry overloads when the caller walks the roster
+    void Insert(Unit const* unit) { Insert(_roster->GetSlot(unit->GetGUID()), unit->GetGUID()); }
+    bool Contains(Unit const* unit) const { return !IsEmpty() && Contains(_roster->GetSlot(unit->GetGUID()), unit->GetGUID()); }
+
+    void Clear()
+    {
+        _bits = 0;
+        _unslotted.clear();
+    }
+
+    bool IsEmpty() const { return !_bits && _unslotted.empty(); }
+
+private:
+    void Insert(uint8 slot, ObjectGuid guid)
+    {
+        if (slot != RaidRosterSlotNone)
+            _bits |= uint64(1) << slot;
+        else if (!Contains(slot, guid))
+            _unslotted.push_back(guid);
+    }
+
+    bool Contains(uint8 slot, ObjectGuid guid) const
+    {
+        if (slot != RaidRosterSlotNone)
+            return _bits & (uint64(1) << slot);
+
+        return std::find(_unslotted.begin(), _unslotted.end(), guid) != _unslotted.end();
+    }
+
+    RaidRoster const* _roster;
+    uint64 _bits{};
+    std::vector<ObjectGuid> _unslotted; // not in the roster or no slot left, empty in practice
+};
+
+#endif
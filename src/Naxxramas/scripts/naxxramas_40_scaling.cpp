@@ -0,0 +1,98 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "naxxramas_40_scaling.h"
+#include "Creature.h"
+#include "ObjectMgr.h"
+#include "VanillaNaxxramas.h"
+#include "naxxramas_40_instance.h"
+#include <algorithm>
+
+// The floor is the coefficient of an empty raid, it grows linearly up to 1 at a full raid
+static float GetRaidScaleCoefficient(float floor, uint8 players)
+{
+    floor = std::clamp(floor, 0.0f, 1.0f);
+    return floor + (1.0f - floor) * std::min(players, RaidSizeScalingFullRaid) / RaidSizeScalingFullRaid;
+}
+
+void RaidSizeScaling::Lock(uint8 players)
+{
+    if (_locked || !sVanillaNaxxramas->raidSizeScaling)
+        return;
+
+    _locked = true;
+    _players = players;
+    _coefficients.health = GetRaidScaleCoefficient(sVanillaNaxxramas->raidSizeScalingHealthFloor, players);
+    _coefficients.damage = GetRaidScaleCoefficient(sVanillaNaxxramas->raidSizeScalingDamageFloor, players);
+    _coefficients.armor = GetRaidScaleCoefficient(sVanillaNaxxramas->raidSizeScalingArmorFloor, players);
+}
+
+RaidSizeScaling::ScaledStats const& RaidSizeScaling::GetScaledStats(Creature const* creature)
+{
+    ScaledStats& stats = _entries[creature->GetEntry()];
+    if (stats.level == creature->GetLevel())
+        return stats;
+
+    // Same formulas as Creature::SelectLevel, from the template so that scaled creatures are not scaled twice.
+    // The rank health mod carries the Rate.Creature.*.HP settings of the realm.
+    CreatureTemplate const* cInfo = creature->GetCreatureTemplate();
+    CreatureBaseStats const* baseStats = sObjectMgr->GetCreatureBaseStats(creature->GetLevel(), cInfo->unit_class);
+    uint32 health = std::max<uint32>(1, baseStats->GenerateHealth(cInfo)) * Creature::_GetHealthMod(cInfo->rank);
+    float damage = baseStats->GenerateBaseDamage(cInfo);
+
+    stats.level = creature->GetLevel();
+    stats.scaled = !(cInfo->flags_extra & CREATURE_FLAG_EXTRA_TRIGGER) && cInfo->type != CREATURE_TYPE_CRITTER;
+    stats.health = std::max<uint32>(1, health * _coefficients.health);
+    stats.minDamage = damage * _coefficients.damage;
+    stats.maxDamage = damage * 1.5f * _coefficients.damage;
+    stats.armor = baseStats->GenerateArmor(cInfo) * _coefficients.armor;
+    return stats;
+}
+
+void RaidSizeScaling::Apply(Creature* creature)
+{
+    if (!_locked || creature->IsPet())
+        return;
+
+    ScaledStats const& stats = GetScaledStats(creature);
+    if (!stats.scaled)
+        return;
+
+    float healthPct = creature->GetHealthPct();
+
+    creature->SetCreateHealth(stats.health);
+    creature->SetModifierValue(UNIT_MOD_HEALTH, BASE_VALUE, float(stats.health));
+    creature->SetBaseWeaponDamage(BASE_ATTACK, MINDAMAGE, stats.minDamage);
+    creature->SetBaseWeaponDamage(BASE_ATTACK, MAXDAMAGE, stats.maxDamage);
+    creature->SetBaseWeaponDamage(OFF_ATTACK, MINDAMAGE, stats.minDamage);
+    creature->SetBaseWeaponDamage(OFF_ATTACK, MAXDAMAGE, stats.maxDamage);
+    creature->SetBaseWeaponDamage(RANGED_ATTACK, MINDAMAGE, stats.minDamage);
+    creature->SetBaseWeaponDamage(RANGED_ATTACK, MAXDAMAGE, stats.maxDamage);
+    creature->SetModifierValue(UNIT_MOD_ARMOR, BASE_VALUE, float(stats.armor));
+    creature->UpdateAllStats();
+
+    if (creature->IsAlive())
+        creature->SetHealth(std::max<uint32>(1, creature->CountPctFromMaxHealth(healthPct)));
+
+    creature->ResetPlayerDamageReq();
+}
+
+void ApplyNaxxramasRaidSizeScaling(Creature* creature)
+{
+    if (NaxxramasInstanceScript* instance = GetNaxxramasInstance(creature->GetInstanceScript()))
+        instance->GetRaidSizeScaling().Apply(creature);
+}
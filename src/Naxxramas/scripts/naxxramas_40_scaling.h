@@ -0,0 +1,71 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DEF_NAXXRAMAS_40_SCALING_H
+#define DEF_NAXXRAMAS_40_SCALING_H
+
+#include "Define.h"
+#include <unordered_map>
+
+class Creature;
+
+static constexpr uint8 RaidSizeScalingFullRaid = 40;
+
+struct RaidScaleCoefficients
+{
+    float health;
+    float damage;
+    float armor;
+};
+
+// Health, damage and armor of the Naxx40 creatures scaled down to the size of the raid.
+// The size is locked at the first boss pull and kept for the lifetime of the instance.
+// Scaled base stats are computed once per entry and set on every creature of that entry,
+// nothing is recomputed when they deal or take damage.
+class RaidSizeScaling
+{
+public:
+    // Does nothing unless VanillaNaxxramas.Naxxramas.RaidSizeScaling is enabled
+    void Lock(uint8 players);
+    bool IsLocked() const { return _locked; }
+    uint8 GetPlayerCount() const { return _players; }
+    RaidScaleCoefficients const& GetCoefficients() const { return _coefficients; }
+
+    // Keeps the health percentage of the creature, calling it again has no further effect.
+    // Creature::Respawn puts the template stats back, respawned creatures must be scaled again.
+    void Apply(Creature* creature);
+
+private:
+    struct ScaledStats
+    {
+        uint8 level;
+        bool scaled; // triggers and critters keep their stats
+        uint32 health;
+        float minDamage;
+        float maxDamage;
+        uint32 armor;
+    };
+
+    ScaledStats const& GetScaledStats(Creature const* creature);
+
+    std::unordered_map<uint32, ScaledStats> _entries;
+    RaidScaleCoefficients _coefficients{ 1.0f, 1.0f, 1.0f };
+    uint8 _players{};
+    bool _locked{};
+};
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DEF_NAXXRAMAS_40_SPAWN_SCHEDULER_H
+#define DEF_NAXXRAMAS_40_SPAWN_SCHEDULER_H
+
+#include "Creature.h"
+#include "VanillaNaxxramas.h"
+#include <vector>
+
+struct PendingSpawn
+{
+    uint32 entry;
+    Position pos;
+    TempSummonType type;
+    uint32 despawnTime;
+};
+
+// Spreads a bulk of summons over several updates of the summoner, at most
+// VanillaNaxxramas.Naxxramas.SpawnBudgetPerTick per call to Update.
+// Summons keep the exact positions they were queued with.
+class SpawnScheduler
+{
+public:
+    void Queue(uint32 entry, Position const& pos, TempSummonType type = TEMPSUMMON_MANUAL_DESPAWN, uint32 despawnTime = 0)
+    {
+        _pending.push_back({ entry, pos, type, despawnTime });
+    }
+
+    void Update(Creature* summoner)
+    {
+        if (IsEmpty())
+            return;
+
+        uint32 budget = sVanillaNaxxramas->spawnBudgetPerTick;
+        for (uint32 spawned = 0; _next < _pending.size() && (!budget || spawned < budget); ++spawned, ++_next)
+        {
+            PendingSpawn const& spawn = _pending[_next];
+            summoner->SummonCreature(spawn.entry, spawn.pos, spawn.type, spawn.despawnTime);
+        }
+
+        if (IsEmpty())
+            Clear();
+    }
+
+    // Drops the summons that were not made yet
+    void Clear()
+    {
+        _pending.clear();
+        _next = 0;
+    }
+
+    bool IsEmpty() const { return _next >= _pending.size(); }
+    std::size_t GetPendingCount() const { return _pending.size() - _next; }
+
+private:
+    std::vector<PendingSpawn> _pending;
+    std::size_t _next{};
+};
+
+#endif
@@ -0,0 +1,127 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "naxxramas_40_summon_pool.h"
+#include "CreatureAI.h"
+#include "ObjectAccessor.h"
+#include "TemporarySummon.h"
+#include "VanillaNaxxramas.h"
+#include "naxxramas_40_instance.h"
+
+Creature* SummonPool::Acquire(Creature* summoner, uint32 entry, Position const& pos)
+{
+    auto itr = _free.find(entry);
+    if (itr != _free.end())
+    {
+        std::vector<ObjectGuid>& guids = itr->second;
+        while (!guids.empty())
+        {
+            Creature* creature = ObjectAccessor::GetCreature(*summoner, guids.back());
+            guids.pop_back();
+
+            // Despawned in the meantime or summoned by someone else
+            TempSummon* summon = creature ? creature->ToTempSummon() : nullptr;
+            if (!summon || summon->GetSummonerGUID() != summoner->GetGUID())
+                continue;
+
+            // Moved while still a corpse, so it respawns at its new home
+            summon->NearTeleportTo(pos.GetPositionX(), pos.GetPositionY(), pos.GetPositionZ(), pos.GetOrientation());
+            summon->SetHomePosition(pos);
+            summon->Respawn(true);
+            ApplyNaxxramasRaidSizeScaling(summon);
+            summon->SetReactState(REACT_AGGRESSIVE);
+            summon->SetWalk(false);
+            ++_hits;
+
+            if (summoner->IsAIEnabled)
+                summoner->AI()->JustSummoned(summon);
+
+            return summon;
+        }
+    }
+
+    ++_misses;
+    return summoner->SummonCreature(entry, pos);
+}
+
+bool SummonPool::Release(Creature* summon)
+{
+    if (!summon->IsSummon())
+        return false;
+
+    std::vector<ObjectGuid>& guids = _free[summon->GetEntry()];
+    if (guids.size() >= SummonPoolMaxFreePerEntry)
+        return false;
+
+    // The corpse would decay and unsummon the creature long before the next wave needs it,
+    // pooled corpses stay until they are acquired or DespawnAll clears them
+    summon->SetCorpseRemoveTime(SummonPoolCorpseDelay);
+    guids.push_back(summon->GetGUID());
+    return true;
+}
+
+void SummonPool::DespawnAll(Creature* summoner, uint32 entry)
+{
+    auto itr = _free.find(entry);
+    if (itr == _free.end())
+        return;
+
+    for (ObjectGuid const& guid : itr->second)
+        if (Creature* creature = ObjectAccessor::GetCreature(*summoner, guid))
+            creature->DespawnOrUnsummon();
+
+    itr->second.clear();
+}
+
+uint32 SummonPool::GetFreeCount() const
+{
+    uint32 count = 0;
+    for (auto const& [entry, guids] : _free)
+        count += guids.size();
+
+    return count;
+}
+
+SummonPool* NaxxramasInstanceScript::GetSummonPool()
+{
+    return sVanillaNaxxramas->summonPooling ? &_summonPool : nullptr;
+}
+
+Creature* SummonNaxxramasCreature(Creature* summoner, uint32 entry, Position const& pos)
+{
+    if (NaxxramasInstanceScript* instance = GetNaxxramasInstance(summoner->GetInstanceScript()))
+        if (SummonPool* pool = instance->GetSummonPool())
+            return pool->Acquire(summoner, entry, pos);
+
+    return summoner->SummonCreature(entry, pos);
+}
+
+bool ReleaseNaxxramasCreature(Creature* summon)
+{
+    if (NaxxramasInstanceScript* instance = GetNaxxramasInstance(summon->GetInstanceScript()))
+        if (SummonPool* pool = instance->GetSummonPool())
+            return pool->Release(summon);
+
+    return false;
+}
+
+void DespawnNaxxramasPool(Creature* summoner, uint32 entry)
+{
+    if (NaxxramasInstanceScript* instance = GetNaxxramasInstance(summoner->GetInstanceScript()))
+        if (SummonPool* pool = instance->GetSummonPool())
+            pool->DespawnAll(summoner, entry);
+}
@@ -0,0 +1,58 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DEF_NAXXRAMAS_40_SUMMON_POOL_H
+#define DEF_NAXXRAMAS_40_SUMMON_POOL_H
+
+#include "ObjectGuid.h"
+#include <unordered_map>
+#include <vector>
+
+class Creature;
+struct Position;
+
+static constexpr uint8 SummonPoolMaxFreePerEntry = 16;
+static constexpr uint32 SummonPoolCorpseDelay     = 2 * 60 * 60; // seconds, outlasts any encounter
+
+// Dead summons of an encounter are kept as corpses and respawned in place of a new
+// SummonCreature call, so waves of adds reuse the same Creature objects. Released corpses
+// do not decay, they stay in the pool until acquired or despawned with their encounter.
+class SummonPool
+{
+public:
+    // Respawns a released creature of that entry at pos, summons a new one when there is none.
+    // The summoner's JustSummoned is called in both cases.
+    Creature* Acquire(Creature* summoner, uint32 entry, Position const& pos);
+
+    // The creature died or is no longer needed by its encounter, returns false when the pool is full.
+    // A corpse despawned by other means is skipped by Acquire.
+    bool Release(Creature* summon);
+
+    // Despawns the released creatures of that entry, called when their encounter resets
+    void DespawnAll(Creature* summoner, uint32 entry);
+
+    uint32 GetHits() const { return _hits; }
+    uint32 GetMisses() const { return _misses; }
+    uint32 GetFreeCount() const;
+
+private:
+    std::unordered_map<uint32, std::vector<ObjectGuid>> _free;
+    uint32 _hits{};
+    uint32 _misses{};
+};
+
+#endif
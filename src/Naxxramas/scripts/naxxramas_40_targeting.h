@@ -0,0 +1,268 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DEF_NAXXRAMAS_40_TARGETING_H
+#define DEF_NAXXRAMAS_40_TARGETING_H
+
+#include "Random.h"
+#include "ThreatMgr.h"
+#include "Unit.h"
+#include "naxxramas_40_roster.h"
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+// Vector with inline storage for the small, bounded target sets of boss scripts.
+// push_back on a full vector is ignored and reported through its return value.
+template<typename T, std::size_t N>
+class FixedVector
+{
+public:
+    bool push_back(T const& value)
+    {
+        if (_size == N)
+            return false;
+
+        _data[_size++] = value;
+        return true;
+    }
+
+    void pop_back() { --_size; }
+    void clear() { _size = 0; }
+
+    std::size_t size() const { return _size; }
+    static constexpr std::size_t capacity() { return N; }
+    bool empty() const { return !_size; }
+    bool full() const { return _size == N; }
+
+    T& operator[](std::size_t index) { return _data[index]; }
+    T const& operator[](std::size_t index) const { return _data[index]; }
+    T& back() { return _data[_size - 1]; }
+
+    T* begin() { return _data.data(); }
+    T* end() { return _data.data() + _size; }
+    T const* begin() const { return _data.data(); }
+    T const* end() const { return _data.data() + _size; }
+
+private:
+    std::array<T, N> _data{};
+    std::size_t _size{};
+};
+
+// Predicates of the threat list selections, combined at compile time with AllOf
+namespace NaxxTarget
+{
+    struct IsPlayer
+    {
+        bool operator()(Unit* target) const { return target->IsPlayer(); }
+    };
+
+    struct IsAlive
+    {
+        bool operator()(Unit* target) const { return target->IsAlive(); }
+    };
+
+    // Not the current victim of source
+    struct NotTank
+    {
+        Unit const* source;
+        bool operator()(Unit* target) const { return source->GetVictim() != target; }
+    };
+
+    struct HasPower
+    {
+        Powers power;
+        bool operator()(Unit* target) const { return target->getPowerType() == power && target->GetPower(power); }
+    };
+
+    struct NotAura
+    {
+        uint32 spellId;
+        bool operator()(Unit* target) const { return !target->HasAura(spellId); }
+    };
+
+    struct InRange
+    {
+        Unit const* source;
+        float dist;
+        bool operator()(Unit* target) const { return source->IsWithinCombatRange(target, dist); }
+    };
+
+    // In the room of that boss, as RaidRoster::GetRoom sees it
+    struct InRoom
+    {
+        uint8 bossId;
+        bool operator()(Unit* target) const { return RaidRoster::GetRoom(*target) == bossId; }
+    };
+
+    // Not in a RaidMemberSet or a container of guids, such as the players already picked this phase
+    template<typename Container>
+    struct NotInSet
+    {
+        Container const& guids;
+        bool operator()(Unit* target) const
+        {
+            if constexpr (std::is_same_v<Container, RaidMemberSet>)
+                return !guids.Contains(target);
+            else
+                return std::find(guids.begin(), guids.end(), target->GetGUID()) == guids.end();
+        }
+    };
+
+    template<typename Container>
+    NotInSet(Container const&) -> NotInSet<Container>;
+
+    template<typename... Predicates>
+    auto AllOf(Predicates... preds)
+    {
+        return [=](Unit* target) { return (preds(target) && ...); };
+    }
+}
+
+// Skips the first count targets that match the predicate the way SelectTarget applies its position:
+// among the matching targets the current victim comes first, then the others in threat order.
+class ThreatListSkip
+{
+public:
+    template<typename Predicate>
+    ThreatListSkip(ThreatMgr& threatMgr, std::size_t count, Predicate const& pred) : _count(count)
+    {
+        if (!_count)
+            return;
+
+        HostileReference* victim = threatMgr.getCurrentVictim();
+        if (victim && victim->getTarget() && pred(victim->getTarget()))
+        {
+            _victim = victim->getTarget();
+            --_count;
+        }
+    }
+
+    // Called on the targets that match the predicate, in threat order
+    bool operator()(Unit* target)
+    {
+        if (target == _victim)
+            return true;
+
+        if (!_count)
+            return false;
+
+        --_count;
+        return true;
+    }
+
+private:
+    Unit* _victim{};
+    std::size_t _count;
+};
+
+// Up to count random targets of the threat list that match pred, without repetition, skipping the
+// first skip matching targets like the position of SelectTarget does. Reservoir sampling in a single
+// pass over the threat list, count must not exceed N.
+template<std::size_t N, typename Predicate>
+FixedVector<Unit*, N> SelectRandomThreat(ThreatMgr& threatMgr, std::size_t count, Predicate&& pred, std::size_t skip = 0)
+{
+    FixedVector<Unit*, N> targets;
+    count = std::min(count, N);
+
+    ThreatListSkip skipped(threatMgr, skip, pred);
+    uint32 seen = 0;
+    for (HostileReference* ref : threatMgr.GetThreatList())
+    {
+        Unit* target = ref->getTarget();
+        if (!target || !pred(target) || skipped(target))
+            continue;
+
+        if (targets.size() < count)
+            targets.push_back(target);
+        else if (uint32 index = urand(0, seen); index < count)
+            targets[index] = target;
+
+        ++seen;
+    }
+
+    return targets;
+}
+
+template<typename Predicate>
+Unit* SelectRandomThreatTarget(ThreatMgr& threatMgr, Predicate&& pred, std::size_t skip = 0)
+{
+    FixedVector<Unit*, 1> targets = SelectRandomThreat<1>(threatMgr, 1, std::forward<Predicate>(pred), skip);
+    return targets.empty() ? nullptr : targets[0];
+}
+
+// Up to count random players of the roster that match pred, reservoir sampled like SelectRandomThreat.
+// pred is given the roster entry, a RaidMemberSet test on it is a single bit test.
+// The entries are only valid until the next roster hook, count must not exceed N.
+template<std::size_t N, typename Predicate>
+FixedVector<RaidRosterEntry const*, N> SelectRandomRoster(RaidRoster const& roster, std::size_t count, Predicate&& pred)
+{
+    FixedVector<RaidRosterEntry const*, N> entries;
+    count = std::min(count, N);
+
+    uint32 seen = 0;
+    for (RaidRosterEntry const& entry : roster.GetEntries())
+    {
+        if (!pred(entry))
+            continue;
+
+        if (entries.size() < count)
+            entries.push_back(&entry);
+        else if (uint32 index = urand(0, seen); index < count)
+            entries[index] = &entry;
+
+        ++seen;
+    }
+
+    return entries;
+}
+
+// Targets of the threat list that match pred, in threat order, skipping the first skip matching
+// targets like the position of SelectTarget does. Stops walking the list as soon as N targets are found.
+template<std::size_t N, typename Predicate>
+FixedVector<Unit*, N> SelectThreatTargets(ThreatMgr& threatMgr, std::size_t skip, Predicate&& pred)
+{
+    FixedVector<Unit*, N> targets;
+    ThreatListSkip skipped(threatMgr, skip, pred);
+    for (HostileReference* ref : threatMgr.GetThreatList())
+    {
+        Unit* target = ref->getTarget();
+        if (!target || !pred(target) || skipped(target))
+            continue;
+
+        targets.push_back(target);
+        if (targets.full())
+            break;
+    }
+
+    return targets;
+}
+
+// The first K targets of the threat list, in threat order, that match pred
+template<std::size_t K, typename Predicate>
+FixedVector<Unit*, K> SelectTopThreat(ThreatMgr& threatMgr, Predicate&& pred)
+{
+    return SelectThreatTargets<K>(threatMgr, 0, std::forward<Predicate>(pred));
+}
+
+template<std::size_t K>
+FixedVector<Unit*, K> SelectTopThreat(ThreatMgr& threatMgr)
+{
+    return SelectTopThreat<K>(threatMgr, [](Unit*) { return true; });
+}
+
+#endif
@@ -0,0 +1,171 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "naxxramas_40_tuning.h"
+#include "Chat.h"
+#include "DatabaseEnv.h"
+#include "Log.h"
+#include "ObjectAccessor.h"
+#include "Player.h"
+#include "QueryResult.h"
+#include "ScriptMgr.h"
+#include "StringFormat.h"
+#include "Timer.h"
+
+// The GM who asked for a reload, the console reads the log instead
+static void NotifyReloadRequester(ObjectGuid requester, std::string const& message)
+{
+    if (requester.IsEmpty())
+        return;
+
+    if (Player* player = ObjectAccessor::FindConnectedPlayer(requester))
+        ChatHandler(player->GetSession()).SendSysMessage(message);
+}
+
+Naxx40Tuning::Naxx40Tuning()
+{
+    Publish(std::make_shared<Naxx40TuningSnapshot const>(Naxx40TuningSnapshot{ Naxx40TuningDefaults, 0 }));
+}
+
+Naxx40Tuning* Naxx40Tuning::instance()
+{
+    static Naxx40Tuning instance;
+    return &instance;
+}
+
+void Naxx40Tuning::LoadFromDB()
+{
+    uint32 oldMSTime = getMSTime();
+
+    uint32 count = 0;
+    std::shared_ptr<Naxx40TuningSnapshot> snapshot = BuildSnapshot(WorldDatabase.Query("SELECT `TuningId`, `SpellId`, `MinValue`, `MaxValue` FROM `naxx40_encounter_tuning`"), count);
+    if (!snapshot)
+    {
+        LOG_INFO("module", ">> Loaded 0 Naxx40 encounter tuning values, using the compiled defaults");
+        return;
+    }
+
+    Publish(std::move(snapshot));
+    LOG_INFO("module", ">> Loaded {} Naxx40 encounter tuning values in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
+}
+
+bool Naxx40Tuning::ReloadAsync(ObjectGuid requester)
+{
+    if (_reloading)
+        return false;
+
+    _reloading = true;
+    _queryProcessor.AddCallback(WorldDatabase.AsyncQuery("SELECT `TuningId`, `SpellId`, `MinValue`, `MaxValue` FROM `naxx40_encounter_tuning`")
+        .WithCallback([this, requester](QueryResult result)
+    {
+        _reloading = false;
+
+        uint32 count = 0;
+        std::shared_ptr<Naxx40TuningSnapshot> snapshot = BuildSnapshot(result, count);
+        if (!snapshot)
+        {
+            // An empty or unreadable table must not silently reset running encounters to the defaults
+            LOG_ERROR("module", "Reload of naxx40_encounter_tuning failed or found no valid row, keeping generation {}", GetGeneration());
+            NotifyReloadRequester(requester, Acore::StringFormat("Reload of naxx40_encounter_tuning failed or found no valid row, the values of generation {} stay in use.", GetGeneration()));
+            return;
+        }
+
+        Publish(std::move(snapshot));
+
+        LOG_INFO("module", "Reloaded {} Naxx40 encounter tuning values, generation {}", count, GetGeneration());
+        NotifyReloadRequester(requester, Acore::StringFormat("Reloaded {} Naxx40 encounter tuning values, generation {}.", count, GetGeneration()));
+    }));
+
+    return true;
+}
+
+void Naxx40Tuning::ProcessReload()
+{
+    _queryProcessor.ProcessReadyCallbacks();
+}
+
+std::shared_ptr<Naxx40TuningSnapshot> Naxx40Tuning::BuildSnapshot(QueryResult result, uint32& count) const
+{
+    auto snapshot = std::make_shared<Naxx40TuningSnapshot>();
+    snapshot->entries = Naxx40TuningDefaults;
+    snapshot->generation = GetGeneration() + 1;
+
+    if (!result)
+        return nullptr;
+
+    //                0           1          2           3
+    // SELECT `TuningId`, `SpellId`, `MinValue`, `MaxValue`
+    do
+    {
+        Field* fields = result->Fetch();
+        uint32 id = fields[0].Get<uint8>();
+        uint32 spellId = fields[1].Get<uint32>();
+        int32 minValue = fields[2].Get<int32>();
+        int32 maxValue = fields[3].Get<int32>();
+
+        if (id >= MAX_NAXX40_TUNING)
+        {
+            LOG_ERROR("db.query", "Table `naxx40_encounter_tuning` has unknown TuningId {}, skipped.", id);
+            continue;
+        }
+
+        if (minValue > maxValue)
+        {
+            LOG_ERROR("db.query", "Table `naxx40_encounter_tuning` has MinValue {} above MaxValue {} for TuningId {}, skipped.", minValue, maxValue, id);
+            continue;
+        }
+
+        if (spellId != Naxx40TuningDefaults[id].spellId)
+            LOG_ERROR("db.query", "Table `naxx40_encounter_tuning` has SpellId {} for TuningId {}, the value is passed to spell {}.", spellId, id, Naxx40TuningDefaults[id].spellId);
+
+        snapshot->entries[id].minValue = minValue;
+        snapshot->entries[id].maxValue = maxValue;
+        ++count;
+    } while (result->NextRow());
+
+    return count ? snapshot : nullptr;
+}
+
+void Naxx40Tuning::Publish(std::shared_ptr<Naxx40TuningSnapshot const> snapshot)
+{
+    _current.store(snapshot.get(), std::memory_order_release);
+
+    // Maps are not updating while the world thread runs, the previous snapshot has no reader left
+    _owner = std::move(snapshot);
+}
+
+class naxxramas_40_tuning_worldscript : public WorldScript
+{
+public:
+    naxxramas_40_tuning_worldscript() : WorldScript("naxxramas_40_tuning_worldscript") { }
+
+    void OnLoadCustomDatabaseTable() override
+    {
+        LOG_INFO("server.loading", "Loading Naxx40 encounter tuning...");
+        sNaxx40Tuning->LoadFromDB();
+    }
+
+    void OnUpdate(uint32 /*diff*/) override
+    {
+        sNaxx40Tuning->ProcessReload();
+    }
+};
+
+void AddSC_naxxramas_40_tuning()
+{
+    new naxxramas_40_tuning_worldscript();
+}
@@ -0,0 +1,75 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DEF_NAXXRAMAS_40_TUNING_H
+#define DEF_NAXXRAMAS_40_TUNING_H
+
+#include "AsyncCallbackProcessor.h"
+#include "DatabaseEnvFwd.h"
+#include "ObjectGuid.h"
+#include "QueryCallback.h"
+#include "naxxramas_40_tuning_data.h"
+#include <atomic>
+#include <memory>
+
+struct Naxx40TuningSnapshot
+{
+    std::array<Naxx40TuningEntry, MAX_NAXX40_TUNING> entries;
+    uint32 generation;
+};
+
+// Damage values of the Naxx40 encounters. The compiled defaults are overridden at startup
+// by the rows of naxx40_encounter_tuning, lookups are a single indexed load afterwards.
+// Values are read from an immutable snapshot. A reload queries the table on a database
+// worker and swaps the snapshot pointer from the world update, between two map updates,
+// so scripts never see a snapshot being freed and take no lock to read it.
+// A load or reload without any valid row keeps the snapshot in use.
+class Naxx40Tuning
+{
+public:
+    static Naxx40Tuning* instance();
+
+    void LoadFromDB();
+
+    // Returns false when a reload is already pending. The requester, if any, is told
+    // of the outcome once the query completes.
+    bool ReloadAsync(ObjectGuid requester);
+    // Publishes the snapshot of a finished reload, world thread only
+    void ProcessReload();
+
+    Naxx40TuningEntry const& Get(Naxx40TuningId id) const { return GetSnapshot()->entries[id]; }
+    int32 Roll(Naxx40TuningId id) const { return Get(id).Roll(); }
+    int32 GetBasePoints(Naxx40TuningId id) const { return Get(id).minValue; }
+    uint32 GetGeneration() const { return GetSnapshot()->generation; }
+
+private:
+    Naxx40Tuning();
+
+    Naxx40TuningSnapshot const* GetSnapshot() const { return _current.load(std::memory_order_acquire); }
+    // Null when the query failed or had no valid row
+    std::shared_ptr<Naxx40TuningSnapshot> BuildSnapshot(QueryResult result, uint32& count) const;
+    void Publish(std::shared_ptr<Naxx40TuningSnapshot const> snapshot);
+
+    std::atomic<Naxx40TuningSnapshot const*> _current;
+    std::shared_ptr<Naxx40TuningSnapshot const> _owner; // world thread only, keeps _current alive
+    QueryCallbackProcessor _queryProcessor;
+    bool _reloading{};
+};
+
+#define sNaxx40Tuning Naxx40Tuning::instance()
+
+#endif
@@ -0,0 +1,116 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DEF_NAXXRAMAS_40_TUNING_DATA_H
+#define DEF_NAXXRAMAS_40_TUNING_DATA_H
+
+#include "Define.h"
+#include "Random.h"
+#include <array>
+
+// Dense ids of the Naxx40 damage values, TuningId column of naxx40_encounter_tuning.
+// Append new ids at the end, existing ids are stored in the database.
+enum Naxx40TuningId : uint8
+{
+    TUNING_PATCHWERK_HATEFUL_STRIKE             = 0,
+    TUNING_GROBBULUS_SLIME_SPRAY                = 1,
+    TUNING_GROBBULUS_MUTATING_EXPLOSION         = 2,
+    TUNING_GROBBULUS_POISON_CLOUD               = 3,
+    TUNING_THADDIUS_CHAIN_LIGHTNING             = 4,
+    TUNING_THADDIUS_BALL_LIGHTNING              = 5,
+    TUNING_THADDIUS_TESLA_SHOCK                 = 6,
+    TUNING_THADDIUS_CHARGE                      = 7,
+    TUNING_ANUBREKHAN_LOCUST_SWARM              = 8,
+    TUNING_MAEXXNA_WEB_WRAP                     = 9,
+    TUNING_NOTH_PLAGUEBRINGER_INSTANT           = 10,
+    TUNING_NOTH_PLAGUEBRINGER_PERIODIC          = 11,
+    TUNING_HEIGAN_ERUPTION                      = 12,
+    TUNING_HEIGAN_PLAGUE_CLOUD                  = 13,
+    TUNING_HEIGAN_DECREPIT_FEVER                = 14,
+    TUNING_HEIGAN_EYE_STALK_MIND_FLAY           = 15,
+    TUNING_LOATHEB_INEVITABLE_DOOM              = 16,
+    TUNING_RAZUVIOUS_DISRUPTING_SHOUT           = 17,
+    TUNING_HORSEMEN_HOLY_BOLT                   = 18,
+    TUNING_HORSEMEN_SHADOW_BOLT                 = 19,
+    TUNING_HORSEMEN_METEOR                      = 20,
+    TUNING_HORSEMEN_HOLY_WRATH                  = 21,
+    TUNING_HORSEMEN_MARK_2                      = 22,
+    TUNING_HORSEMEN_MARK_3                      = 23,
+    TUNING_HORSEMEN_MARK_4                      = 24,
+    TUNING_HORSEMEN_MARK_PER_STACK              = 25, // 5 marks and more
+    TUNING_SAPPHIRON_LIFE_DRAIN                 = 26,
+    TUNING_SAPPHIRON_ICEBOLT                    = 27,
+    TUNING_KELTHUZAD_FROSTBOLT                  = 28,
+    TUNING_KELTHUZAD_DARK_BLAST                 = 29,
+    TUNING_CONSUMPTION                          = 30, // Blaumeux void zones
+    TUNING_PATCHWORK_GOLEM_WAR_STOMP            = 31,
+    TUNING_UNHOLY_STAFF_ARCANE_EXPLOSION        = 32,
+    TUNING_SEWAGE_SLIME_DISEASE_CLOUD           = 33,
+    MAX_NAXX40_TUNING
+};
+
+struct Naxx40TuningEntry
+{
+    uint32 spellId; // informative, the spell the value is passed to
+    int32 minValue;
+    int32 maxValue;
+
+    // Fixed values have minValue == maxValue and skip the random roll
+    int32 Roll() const { return minValue < maxValue ? irand(minValue, maxValue) : minValue; }
+};
+
+// Compiled defaults, also the rows of data/sql/db-world/base/naxx40_encounter_tuning.sql.
+// Change both together, the encounter simulator tests fail when they differ.
+static constexpr std::array<Naxx40TuningEntry, MAX_NAXX40_TUNING> Naxx40TuningDefaults =
+{{
+    { 41926, 22100, 22850 }, // TUNING_PATCHWERK_HATEFUL_STRIKE
+    { 28157,  3200,  4800 }, // TUNING_GROBBULUS_SLIME_SPRAY
+    { 28206,  2379,  2379 }, // TUNING_GROBBULUS_MUTATING_EXPLOSION
+    { 28241,  1110,  1290 }, // TUNING_GROBBULUS_POISON_CLOUD
+    { 28167,  1850,  1850 }, // TUNING_THADDIUS_CHAIN_LIGHTNING, the spell rolls (1850, 2150)
+    { 28299,  6000,  6000 }, // TUNING_THADDIUS_BALL_LIGHTNING
+    { 28099,  4374,  4374 }, // TUNING_THADDIUS_TESLA_SHOCK
+    { 28062,  2000,  2000 }, // TUNING_THADDIUS_CHARGE, positive and negative charge
+    { 28786,   812,   812 }, // TUNING_ANUBREKHAN_LOCUST_SWARM
+    { 28622,   657,   843 }, // TUNING_MAEXXNA_WEB_WRAP
+    { 29214,  1757,  1757 }, // TUNING_NOTH_PLAGUEBRINGER_INSTANT
+    { 29214,   874,   874 }, // TUNING_NOTH_PLAGUEBRINGER_PERIODIC
+    { 29371,  3500,  4500 }, // TUNING_HEIGAN_ERUPTION
+    { 30122,  4000,  4000 }, // TUNING_HEIGAN_PLAGUE_CLOUD
+    { 29998,   499,   499 }, // TUNING_HEIGAN_DECREPIT_FEVER
+    { 29407,   750,   750 }, // TUNING_HEIGAN_EYE_STALK_MIND_FLAY
+    { 29204,  2549,  2549 }, // TUNING_LOATHEB_INEVITABLE_DOOM
+    { 26046,  4050,  4950 }, // TUNING_RAZUVIOUS_DISRUPTING_SHOUT
+    { 57376,  1109,  1109 }, // TUNING_HORSEMEN_HOLY_BOLT
+    { 57374,  1109,  1109 }, // TUNING_HORSEMEN_SHADOW_BOLT
+    { 28884, 12824, 12824 }, // TUNING_HORSEMEN_METEOR
+    { 28883,   443,   443 }, // TUNING_HORSEMEN_HOLY_WRATH
+    { 28836,   250,   250 }, // TUNING_HORSEMEN_MARK_2
+    { 28836,  1000,  1000 }, // TUNING_HORSEMEN_MARK_3
+    { 28836,  3000,  3000 }, // TUNING_HORSEMEN_MARK_4
+    { 28836,  1000,  1000 }, // TUNING_HORSEMEN_MARK_PER_STACK
+    { 28542,  1700,  1700 }, // TUNING_SAPPHIRON_LIFE_DRAIN
+    { 28522,  2625,  3375 }, // TUNING_SAPPHIRON_ICEBOLT
+    { 28479,  2550,  3450 }, // TUNING_KELTHUZAD_FROSTBOLT
+    { 28457,  1750,  2250 }, // TUNING_KELTHUZAD_DARK_BLAST
+    { 28865,  3960,  4840 }, // TUNING_CONSUMPTION
+    { 60960,   936,  1064 }, // TUNING_PATCHWORK_GOLEM_WAR_STOMP
+    { 28450,  1838,  2361 }, // TUNING_UNHOLY_STAFF_ARCANE_EXPLOSION
+    { 28153,   278,   322 }, // TUNING_SEWAGE_SLIME_DISEASE_CLOUD
+}};
+
+#endif
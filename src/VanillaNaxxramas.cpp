@@ -19,6 +19,18 @@ public:
     {
         sVanillaNaxxramas->requireAttunement = sConfigMgr->GetOption<bool>("VanillaNaxxramas.Naxxramas.RequireAttunement", true);
         sVanillaNaxxramas->requireNaxxStrath = sConfigMgr->GetOption<bool>("VanillaNaxxramas.Naxxramas.RequireNaxxStrathEntrance", true);
+        sVanillaNaxxramas->encounterProfiling = sConfigMgr->GetOption<bool>("VanillaNaxxramas.Naxxramas.EncounterProfiling", false);
+        sVanillaNaxxramas->encounterProfilingLogInterval = sConfigMgr->GetOption<uint32>("VanillaNaxxramas.Naxxramas.EncounterProfilingLogInterval", 60);
+        sVanillaNaxxramas->heiganBatchedEruption = sConfigMgr->GetOption<bool>("VanillaNaxxramas.Naxxramas.HeiganBatchedEruption", false);
+        sVanillaNaxxramas->summonPooling = sConfigMgr->GetOption<bool>("VanillaNaxxramas.Naxxramas.SummonPooling", false);
+        sVanillaNaxxramas->spawnBudgetPerTick = sConfigMgr->GetOption<uint32>("VanillaNaxxramas.Naxxramas.SpawnBudgetPerTick", 10);
+        sVanillaNaxxramas->dormantWingRadius = sConfigMgr->GetOption<float>("VanillaNaxxramas.Naxxramas.DormantWingRadius", 150.0f);
+        sVanillaNaxxramas->livingPoisonCheckInterval = sConfigMgr->GetOption<uint32>("VanillaNaxxramas.Naxxramas.LivingPoisonCheckInterval", 500);
+        sVanillaNaxxramas->raidSizeScaling = sConfigMgr->GetOption<bool>("VanillaNaxxramas.Naxxramas.RaidSizeScaling", false);
+        sVanillaNaxxramas->raidSizeScalingHealthFloor = sConfigMgr->GetOption<float>("VanillaNaxxramas.Naxxramas.RaidSizeScaling.HealthFloor", 0.3f);
+        sVanillaNaxxramas->raidSizeScalingDamageFloor = sConfigMgr->GetOption<float>("VanillaNaxxramas.Naxxramas.RaidSizeScaling.DamageFloor", 0.5f);
+        sVanillaNaxxramas->raidSizeScalingArmorFloor = sConfigMgr->GetOption<float>("VanillaNaxxramas.Naxxramas.RaidSizeScaling.ArmorFloor", 1.0f);
+        sVanillaNaxxramas->poisonCloudGrowthStep = sConfigMgr->GetOption<float>("VanillaNaxxramas.Naxxramas.PoisonCloudGrowthStep", 0.5f);
     }
 };
 
@@ -21,6 +21,16 @@ public:
     static VanillaNaxxramas* instance();
 
     bool enabled, requireNaxxStrath, requireAttunement;
+    bool encounterProfiling;
+    uint32 encounterProfilingLogInterval;
+    bool heiganBatchedEruption;
+    bool summonPooling;
+    uint32 spawnBudgetPerTick;
+    float dormantWingRadius;
+    uint32 livingPoisonCheckInterval;
+    bool raidSizeScaling;
+    float raidSizeScalingHealthFloor, raidSizeScalingDamageFloor, raidSizeScalingArmorFloor;
+    float poisonCloudGrowthStep;
 };
 
 #define sVanillaNaxxramas VanillaNaxxramas::instance()